@@ -8,6 +8,8 @@
 #include "td/utils/format.h"
 #include "td/utils/Random.h"
 #include "td/utils/crypto.h"
+#include "td/utils/base64.h"
+#include "td/utils/misc.h"
 #include "td/utils/port/signals.h"
 #include "td/utils/port/stacktrace.h"
 #include "td/utils/port/StdStreams.h"
@@ -18,8 +20,10 @@
 #include "block/block.h"
 #include "block/block-auto.h"
 #include "block/mc-config.h"
+#include "block/smc-method.h"
 #include "vm/boc.h"
 #include "vm/cellops.h"
+#include "vm/continuation.h"
 #include "vm/cells/MerkleProof.h"
 #include "ton/ton-shard.h"
 
@@ -36,6 +40,10 @@
 #include "web_server/include/method-getaccount.cpp"
 #include "web_server/include/method-getblock.cpp"
 #include "web_server/include/method-last.cpp"
+#include "web_server/include/method-stats.cpp"
+#include "web_server/include/method-getaccounts.cpp"
+#include "web_server/include/method-subscribe.cpp"
+#include "web_server/include/method-runmethod.cpp"
 
 using td::Ref;
 
@@ -89,15 +97,32 @@ void TestNode::run() {
   ton::ton_api::from_json(gc, gc_j.get_object()).ensure();
 
   CHECK(gc.liteclients_.size() > 0);
-  auto idx =
-      liteserver_idx_ >= 0 ? liteserver_idx_ : td::Random::fast(0, static_cast<td::uint32>(gc.liteclients_.size() - 1));
-  CHECK(idx >= 0 && static_cast<td::uint32>(idx) <= gc.liteclients_.size());
-  auto& cli = gc.liteclients_[idx];
-  td::IPAddress addr;
-  addr.init_host_port(td::IPAddress::ipv4_to_str(cli->ip_), cli->port_).ensure();
-  td::TerminalIO::out() << "using liteserver " << idx << " with addr " << addr << "\n";
+  std::vector<td::uint32> indices;
+  if (all_liteservers_) {
+    for (td::uint32 idx = 0; idx < gc.liteclients_.size(); idx++) {
+      indices.push_back(idx);
+    }
+  } else {
+    auto idx = liteserver_idx_ >= 0 ? liteserver_idx_
+                                    : td::Random::fast(0, static_cast<td::uint32>(gc.liteclients_.size() - 1));
+    CHECK(idx >= 0 && static_cast<td::uint32>(idx) <= gc.liteclients_.size());
+    indices.push_back(idx);
+  }
+
+  std::vector<std::pair<ton::AdnlNodeIdFull, td::IPAddress>> servers;
+  for (auto idx : indices) {
+    auto& cli = gc.liteclients_[idx];
+    td::IPAddress addr;
+    addr.init_host_port(td::IPAddress::ipv4_to_str(cli->ip_), cli->port_).ensure();
+    td::TerminalIO::out() << "using liteserver " << idx << " with addr " << addr << "\n";
+    servers.emplace_back(ton::AdnlNodeIdFull{cli->id_}, addr);
+  }
 
-  client_ = ton::AdnlExtClient::create(ton::AdnlNodeIdFull{cli->id_}, addr, make_callback());
+  if (servers.size() == 1 && connections_per_server_ == 1) {
+    client_ = ton::AdnlExtClient::create(std::move(servers[0].first), servers[0].second, make_callback());
+  } else {
+    client_ = ton::AdnlExtMultiClient::create(std::move(servers), connections_per_server_, make_callback());
+  }
 }
 
 bool TestNode::envelope_send_query(td::BufferSlice query, td::Promise<td::BufferSlice> promise) {
@@ -105,7 +130,14 @@ bool TestNode::envelope_send_query(td::BufferSlice query, td::Promise<td::Buffer
     LOG(ERROR) << "failed to send query to server: not ready";
     return false;
   }
-  auto P = td::PromiseCreator::lambda([promise = std::move(promise)](td::Result<td::BufferSlice> R) mutable {
+  td::BufferSlice cached;
+  bool cacheable = ResponseCache::is_cacheable(query.as_slice());
+  if (cacheable && answer_cache_.get(query.as_slice(), cached)) {
+    promise.set_value(std::move(cached));
+    return true;
+  }
+  auto P = td::PromiseCreator::lambda([SelfId = actor_id(this), cache_key = cacheable ? query.clone() : td::BufferSlice(),
+                                       promise = std::move(promise)](td::Result<td::BufferSlice> R) mutable {
     if (R.is_error()) {
       auto err = R.move_as_error();
       LOG(ERROR) << "failed query: " << err;
@@ -121,6 +153,9 @@ bool TestNode::envelope_send_query(td::BufferSlice query, td::Promise<td::Buffer
       promise.set_error(std::move(err));
       return;
     }
+    if (!cache_key.empty()) {
+      td::actor::send_closure(SelfId, &TestNode::cache_answer, std::move(cache_key), data.clone());
+    }
     promise.set_result(std::move(data));
   });
   td::BufferSlice b =
@@ -130,6 +165,15 @@ bool TestNode::envelope_send_query(td::BufferSlice query, td::Promise<td::Buffer
   return true;
 }
 
+void TestNode::cache_answer(td::BufferSlice query, td::BufferSlice answer) {
+  auto S = check_cacheable_answer(query.as_slice(), answer.clone());
+  if (S.is_error()) {
+    LOG(WARNING) << "answer not cached: " << S;
+    return;
+  }
+  answer_cache_.put(query.as_slice(), std::move(answer));
+}
+
 bool TestNode::register_blkid(const ton::BlockIdExt& blkid) {
   for (const auto& id : known_blk_ids_) {
     if (id == blkid) {
@@ -317,12 +361,11 @@ void TestNode::got_mc_state(ton::BlockIdExt blkid, ton::RootHash root_hash, ton:
   }
   register_blkid(blkid);
   last_state_id_ = blkid;
-  last_state_data_ = data.clone();
-  if (!db_root_.empty()) {
-    auto res = save_db_file(fhash, std::move(data));
-    if (res.is_error()) {
-      LOG(ERROR) << "error saving state file: " << res.to_string();
-    }
+  auto res = load_state(blkid, root_hash, fhash, std::move(data));
+  if (res.is_error()) {
+    LOG(ERROR) << "cannot load state " << blkid.to_str() << " : " << res.move_as_error().to_string();
+  } else {
+    last_state_ = res.move_as_ok();
   }
   show_new_blkids();
 }
@@ -548,6 +591,8 @@ bool TestNode::show_help(std::string command) {
          "status\tShow connection and local database status\n"
          "getaccount <addr> [<block-id-ext>]\tLoads the most recent state of specified account; <addr> is in "
          "[<workchain>:]<hex-or-base64-addr> format\n"
+         "runmethod <addr> <method-id> [<params>...]\tRuns a get-method of the specified account locally over its "
+         "proven state; <method-id> is a number or a method name, <params> are integers\n"
          "allshards [<block-id-ext>]\tShows shard configuration from the most recent masterchain "
          "state or from masterchain state corresponding to <block-id-ext>\n"
          "gethead <block-id-ext>\tShows block header for <block-id-ext>\n"
@@ -586,6 +631,16 @@ bool TestNode::do_parse_line() {
     return parse_account_addr(workchain, addr) &&
            (seekeoln() ? get_account_state(workchain, addr, mc_last_id_)
                        : parse_block_id_ext(blkid) && seekeoln() && get_account_state(workchain, addr, blkid));
+  } else if (word == "runmethod") {
+    std::vector<std::string> words;
+    if (!parse_account_addr(workchain, addr)) {
+      return false;
+    }
+    std::string method = get_word();
+    while (!seekeoln()) {
+      words.push_back(get_word());
+    }
+    return run_smc_method(workchain, addr, mc_last_id_, std::move(method), std::move(words));
   } else if (word == "allshards") {
     return eoln() ? get_all_shards() : (parse_block_id_ext(blkid) && seekeoln() && get_all_shards(false, blkid));
   } else if (word == "getblock") {
@@ -674,6 +729,9 @@ bool TestNode::get_account_state(ton::WorkchainId workchain, ton::StdSmcAddress
   if (!ref_blkid.is_valid()) {
     return set_error("must obtain last block information before making other queries");
   }
+  if (last_state_.root.not_null() && last_state_.blkid == ref_blkid && workchain == ton::masterchainId) {
+    return show_loaded_account_state(workchain, addr);
+  }
   if (!(ready_ && !client_.empty())) {
     return set_error("server connection not ready");
   }
@@ -805,162 +863,170 @@ td::Status check_block_header_proof(Ref<vm::Cell> root, ton::BlockIdExt blkid,
   return td::Status::OK();
 }
 
-void TestNode::got_account_state(ton::BlockIdExt ref_blk, ton::BlockIdExt blk, ton::BlockIdExt shard_blk,
-                                 td::BufferSlice shard_proof, td::BufferSlice proof, td::BufferSlice state,
-                                 ton::WorkchainId workchain, ton::StdSmcAddress addr) {
-  LOG(INFO) << "got account state for " << workchain << ":" << addr.to_hex() << " with respect to blocks "
-            << blk.to_str() << (shard_blk == blk ? "" : std::string{" and "} + shard_blk.to_str());
-  Ref<vm::Cell> root;
-  if (!state.empty()) {
-    auto R = vm::std_boc_deserialize(state.clone());
-    if (R.is_error()) {
-      LOG(ERROR) << "cannot deserialize account state";
-      return;
-    }
-    root = R.move_as_ok();
-    CHECK(root.not_null());
+td::Status TestNode::check_shard_config_proof(ton::BlockIdExt blk, ton::BlockIdExt shard_blk,
+                                              td::BufferSlice shard_proof) {
+  if (!blk.is_masterchain() || !blk.is_valid_full()) {
+    return td::Status::Error(PSTRING() << "reference block " << blk.to_str()
+                                       << " for a getAccountState query must belong to the masterchain");
   }
-  if (blk != ref_blk && ref_blk.id.seqno != ~0U) {
-    LOG(ERROR) << "obtained getAccountState() for a different reference block " << blk.to_str()
-               << " instead of requested " << ref_blk.to_str();
-    return;
+  auto P = vm::std_boc_deserialize_multi(std::move(shard_proof));
+  if (P.is_error()) {
+    return td::Status::Error("cannot deserialize shard configuration proof");
   }
-  if (!shard_blk.is_valid_full()) {
-    LOG(ERROR) << "shard block id " << shard_blk.to_str() << " in answer is invalid";
-    return;
+  auto P_roots = P.move_as_ok();
+  if (P_roots.size() != 2) {
+    return td::Status::Error("shard configuration proof must have exactly two roots");
   }
-  if (!ton::shard_contains(shard_blk.shard_full(), ton::extract_addr_prefix(workchain, addr))) {
-    LOG(ERROR) << "received data from shard block " << shard_blk.to_str() << " that cannot contain requested account "
-               << workchain << ":" << addr.to_hex();
-    return;
-  }
-  if (blk != shard_blk) {
-    if (!blk.is_masterchain() || !blk.is_valid_full()) {
-      LOG(ERROR) << "reference block " << blk.to_str() << " for a getAccountState query must belong to the masterchain";
-      return;
+  try {
+    auto mc_state_root = vm::MerkleProof::virtualize(std::move(P_roots[1]), 1);
+    if (mc_state_root.is_null()) {
+      return td::Status::Error("shard configuration proof is invalid");
     }
-    auto P = vm::std_boc_deserialize_multi(std::move(shard_proof));
-    if (P.is_error()) {
-      LOG(ERROR) << "cannot deserialize shard configuration proof";
-      return;
+    ton::Bits256 mc_state_hash = mc_state_root->get_hash().bits();
+    auto res1 =
+        check_block_header_proof(vm::MerkleProof::virtualize(std::move(P_roots[0]), 1), blk, &mc_state_hash, true);
+    if (res1.is_error()) {
+      return td::Status::Error(PSTRING() << "error in shard configuration block header proof : "
+                                         << res1.move_as_error().message());
     }
-    auto P_roots = P.move_as_ok();
-    if (P_roots.size() != 2) {
-      LOG(ERROR) << "shard configuration proof must have exactly two roots";
-      return;
+    block::gen::ShardStateUnsplit::Record sstate;
+    if (!(tlb::unpack_cell(mc_state_root, sstate))) {
+      return td::Status::Error("cannot unpack masterchain state header");
     }
-    try {
-      auto mc_state_root = vm::MerkleProof::virtualize(std::move(P_roots[1]), 1);
-      if (mc_state_root.is_null()) {
-        LOG(ERROR) << "shard configuration proof is invalid";
-        return;
-      }
-      ton::Bits256 mc_state_hash = mc_state_root->get_hash().bits();
-      auto res1 =
-          check_block_header_proof(vm::MerkleProof::virtualize(std::move(P_roots[0]), 1), blk, &mc_state_hash, true);
-      if (res1.is_error()) {
-        LOG(ERROR) << "error in shard configuration block header proof : " << res1.move_as_error().to_string();
-        return;
-      }
-      block::gen::ShardStateUnsplit::Record sstate;
-      if (!(tlb::unpack_cell(mc_state_root, sstate))) {
-        LOG(ERROR) << "cannot unpack masterchain state header";
-        return;
-      }
-      auto shards_dict = block::Config::extract_shard_hashes_dict(std::move(mc_state_root));
-      if (!shards_dict) {
-        LOG(ERROR) << "cannot extract shard configuration dictionary from proof";
-        return;
-      }
-      vm::CellSlice cs;
-      ton::ShardIdFull true_shard;
-      if (!block::ShardConfig::get_shard_hash_raw_from(*shards_dict, cs, shard_blk.shard_full(), true_shard)) {
-        LOG(ERROR) << "masterchain state contains no information for shard " << shard_blk.shard_full().to_str();
-        return;
-      }
-      auto shard_info = block::McShardHash::unpack(cs, true_shard);
-      if (shard_info.is_null()) {
-        LOG(ERROR) << "cannot unpack information for shard " << shard_blk.shard_full().to_str()
-                   << " from masterchain state";
-        return;
-      }
-      if (shard_info->top_block_id() != shard_blk) {
-        LOG(ERROR) << "shard configuration mismatch: expected to find block " << shard_blk.to_str() << " , found "
-                   << shard_info->top_block_id().to_str();
-        return;
-      }
-    } catch (vm::VmError err) {
-      LOG(ERROR) << "error while traversing shard configuration proof : " << err.get_msg();
-      return;
-    } catch (vm::VmVirtError err) {
-      LOG(ERROR) << "virtualization error while traversing shard configuration proof : " << err.get_msg();
-      return;
+    auto shards_dict = block::Config::extract_shard_hashes_dict(std::move(mc_state_root));
+    if (!shards_dict) {
+      return td::Status::Error("cannot extract shard configuration dictionary from proof");
     }
+    vm::CellSlice cs;
+    ton::ShardIdFull true_shard;
+    if (!block::ShardConfig::get_shard_hash_raw_from(*shards_dict, cs, shard_blk.shard_full(), true_shard)) {
+      return td::Status::Error(PSTRING() << "masterchain state contains no information for shard "
+                                         << shard_blk.shard_full().to_str());
+    }
+    auto shard_info = block::McShardHash::unpack(cs, true_shard);
+    if (shard_info.is_null()) {
+      return td::Status::Error(PSTRING() << "cannot unpack information for shard " << shard_blk.shard_full().to_str()
+                                         << " from masterchain state");
+    }
+    if (shard_info->top_block_id() != shard_blk) {
+      return td::Status::Error(PSTRING() << "shard configuration mismatch: expected to find block "
+                                         << shard_blk.to_str() << " , found " << shard_info->top_block_id().to_str());
+    }
+  } catch (vm::VmError err) {
+    return td::Status::Error(PSTRING() << "error while traversing shard configuration proof : " << err.get_msg());
+  } catch (vm::VmVirtError err) {
+    return td::Status::Error(PSTRING() << "virtualization error while traversing shard configuration proof : "
+                                       << err.get_msg());
   }
+  return td::Status::OK();
+}
+
+td::Status TestNode::check_account_proof(ton::BlockIdExt shard_blk, td::BufferSlice proof, Ref<vm::Cell> root,
+                                         ton::WorkchainId workchain, ton::StdSmcAddress addr,
+                                         ton::LogicalTime& last_trans_lt, ton::Bits256& last_trans_hash) {
   auto Q = vm::std_boc_deserialize_multi(std::move(proof));
   if (Q.is_error()) {
-    LOG(ERROR) << "cannot deserialize account proof";
-    return;
+    return td::Status::Error("cannot deserialize account proof");
   }
   auto Q_roots = Q.move_as_ok();
   if (Q_roots.size() != 2) {
-    LOG(ERROR) << "account state proof must have exactly two roots";
-    return;
+    return td::Status::Error("account state proof must have exactly two roots");
   }
-  ton::LogicalTime last_trans_lt = 0;
-  ton::Bits256 last_trans_hash;
+  last_trans_lt = 0;
   last_trans_hash.set_zero();
   try {
     auto state_root = vm::MerkleProof::virtualize(std::move(Q_roots[1]), 1);
     if (state_root.is_null()) {
-      LOG(ERROR) << "account state proof is invalid";
-      return;
+      return td::Status::Error("account state proof is invalid");
     }
     ton::Bits256 state_hash = state_root->get_hash().bits();
     auto res1 =
         check_block_header_proof(vm::MerkleProof::virtualize(std::move(Q_roots[0]), 1), shard_blk, &state_hash, true);
     if (res1.is_error()) {
-      LOG(ERROR) << "error in account shard block header proof : " << res1.move_as_error().to_string();
-      return;
+      return td::Status::Error(PSTRING() << "error in account shard block header proof : "
+                                         << res1.move_as_error().message());
     }
     block::gen::ShardStateUnsplit::Record sstate;
     if (!(tlb::unpack_cell(std::move(state_root), sstate))) {
-      LOG(ERROR) << "cannot unpack state header";
-      return;
+      return td::Status::Error("cannot unpack state header");
     }
     vm::AugmentedDictionary accounts_dict{sstate.accounts->prefetch_ref(), 256, block::tlb::aug_ShardAccounts};
     auto acc_csr = accounts_dict.lookup(addr);
     if (acc_csr.not_null()) {
       if (root.is_null()) {
-        LOG(ERROR) << "account state proof shows that account state for " << workchain << ":" << addr.to_hex()
-                   << " must be non-empty, but it actually is empty";
-        return;
+        return td::Status::Error(PSTRING() << "account state proof shows that account state for " << workchain << ":"
+                                           << addr.to_hex() << " must be non-empty, but it actually is empty");
       }
       block::gen::ShardAccount::Record acc_info;
       if (!tlb::csr_unpack(std::move(acc_csr), acc_info)) {
-        LOG(ERROR) << "cannot unpack ShardAccount from proof";
-        return;
+        return td::Status::Error("cannot unpack ShardAccount from proof");
       }
       if (acc_info.account->get_hash().bits().compare(root->get_hash().bits(), 256)) {
-        LOG(ERROR) << "account state hash mismatch: Merkle proof expects "
-                   << acc_info.account->get_hash().bits().to_hex(256) << " but received data has "
-                   << root->get_hash().bits().to_hex(256);
-        return;
+        return td::Status::Error(PSTRING() << "account state hash mismatch: Merkle proof expects "
+                                           << acc_info.account->get_hash().bits().to_hex(256)
+                                           << " but received data has " << root->get_hash().bits().to_hex(256));
       }
       last_trans_hash = acc_info.last_trans_hash;
       last_trans_lt = acc_info.last_trans_lt;
     } else if (root.not_null()) {
-      LOG(ERROR) << "account state proof shows that account state for " << workchain << ":" << addr.to_hex()
-                 << " must be empty, but it is not";
-      return;
+      return td::Status::Error(PSTRING() << "account state proof shows that account state for " << workchain << ":"
+                                         << addr.to_hex() << " must be empty, but it is not");
     }
   } catch (vm::VmError err) {
-    LOG(ERROR) << "error while traversing account proof : " << err.get_msg();
-    return;
+    return td::Status::Error(PSTRING() << "error while traversing account proof : " << err.get_msg());
   } catch (vm::VmVirtError err) {
-    LOG(ERROR) << "virtualization error while traversing account proof : " << err.get_msg();
+    return td::Status::Error(PSTRING() << "virtualization error while traversing account proof : " << err.get_msg());
+  }
+  return td::Status::OK();
+}
+
+void TestNode::got_account_state(ton::BlockIdExt ref_blk, ton::BlockIdExt blk, ton::BlockIdExt shard_blk,
+                                 td::BufferSlice shard_proof, td::BufferSlice proof, td::BufferSlice state,
+                                 ton::WorkchainId workchain, ton::StdSmcAddress addr) {
+  LOG(INFO) << "got account state for " << workchain << ":" << addr.to_hex() << " with respect to blocks "
+            << blk.to_str() << (shard_blk == blk ? "" : std::string{" and "} + shard_blk.to_str());
+  Ref<vm::Cell> root;
+  if (!state.empty()) {
+    auto R = vm::std_boc_deserialize(state.clone());
+    if (R.is_error()) {
+      LOG(ERROR) << "cannot deserialize account state";
+      return;
+    }
+    root = R.move_as_ok();
+    CHECK(root.not_null());
+  }
+  if (blk != ref_blk && ref_blk.id.seqno != ~0U) {
+    LOG(ERROR) << "obtained getAccountState() for a different reference block " << blk.to_str()
+               << " instead of requested " << ref_blk.to_str();
+    return;
+  }
+  if (!shard_blk.is_valid_full()) {
+    LOG(ERROR) << "shard block id " << shard_blk.to_str() << " in answer is invalid";
+    return;
+  }
+  if (!ton::shard_contains(shard_blk.shard_full(), ton::extract_addr_prefix(workchain, addr))) {
+    LOG(ERROR) << "received data from shard block " << shard_blk.to_str() << " that cannot contain requested account "
+               << workchain << ":" << addr.to_hex();
+    return;
+  }
+  if (blk != shard_blk) {
+    auto S = check_shard_config_proof(blk, shard_blk, std::move(shard_proof));
+    if (S.is_error()) {
+      LOG(ERROR) << S.message();
+      return;
+    }
+  }
+  ton::LogicalTime last_trans_lt;
+  ton::Bits256 last_trans_hash;
+  auto S = check_account_proof(shard_blk, std::move(proof), root, workchain, addr, last_trans_lt, last_trans_hash);
+  if (S.is_error()) {
+    LOG(ERROR) << S.message();
     return;
   }
+  show_account_state(std::move(root), last_trans_lt, last_trans_hash);
+}
+
+void TestNode::show_account_state(Ref<vm::Cell> root, ton::LogicalTime last_trans_lt, ton::Bits256 last_trans_hash) {
   auto out = td::TerminalIO::out();
   if (root.not_null()) {
     out << "account state is ";
@@ -974,79 +1040,105 @@ void TestNode::got_account_state(ton::BlockIdExt ref_blk, ton::BlockIdExt blk, t
   }
 }
 
-void TestNode::got_one_transaction(ton::BlockIdExt req_blkid, ton::BlockIdExt blkid, td::BufferSlice proof,
-                                   td::BufferSlice transaction, ton::WorkchainId workchain, ton::StdSmcAddress addr,
-                                   ton::LogicalTime trans_lt, bool dump) {
-  LOG(INFO) << "got transaction " << trans_lt << " for " << workchain << ":" << addr.to_hex()
-            << " with respect to block " << blkid.to_str();
+// a masterchain account is looked up in the loaded masterchain state, so only the cells on its path are read
+bool TestNode::show_loaded_account_state(ton::WorkchainId workchain, ton::StdSmcAddress addr) {
+  LOG(INFO) << "looking up account state for " << workchain << ":" << addr.to_hex() << " in the loaded state of "
+            << last_state_.blkid.to_str();
+  try {
+    block::gen::ShardStateUnsplit::Record sstate;
+    if (!tlb::unpack_cell(last_state_.root, sstate)) {
+      return set_error("cannot unpack state header");
+    }
+    vm::AugmentedDictionary accounts_dict{sstate.accounts->prefetch_ref(), 256, block::tlb::aug_ShardAccounts};
+    auto acc_csr = accounts_dict.lookup(addr);
+    if (acc_csr.is_null()) {
+      show_account_state({}, 0, ton::Bits256::zero());
+      return true;
+    }
+    block::gen::ShardAccount::Record acc_info;
+    if (!tlb::csr_unpack(std::move(acc_csr), acc_info)) {
+      return set_error("cannot unpack ShardAccount from state");
+    }
+    show_account_state(std::move(acc_info.account), acc_info.last_trans_lt, acc_info.last_trans_hash);
+  } catch (vm::VmError err) {
+    return set_error(PSTRING() << "error while looking up account in the loaded state : " << err.get_msg());
+  }
+  return true;
+}
+
+td::Result<Ref<vm::Cell>> TestNode::check_one_transaction(ton::BlockIdExt req_blkid, ton::BlockIdExt blkid,
+                                                         td::BufferSlice proof, td::BufferSlice transaction,
+                                                         ton::WorkchainId workchain, ton::StdSmcAddress addr,
+                                                         ton::LogicalTime trans_lt) {
   if (blkid != req_blkid) {
-    LOG(ERROR) << "obtained TransactionInfo for a different block " << blkid.to_str() << " instead of requested "
-               << req_blkid.to_str();
-    return;
+    return td::Status::Error(PSTRING() << "obtained TransactionInfo for a different block " << blkid.to_str()
+                                       << " instead of requested " << req_blkid.to_str());
   }
   if (!ton::shard_contains(blkid.shard_full(), ton::extract_addr_prefix(workchain, addr))) {
-    LOG(ERROR) << "received data from block " << blkid.to_str() << " that cannot contain requested account "
-               << workchain << ":" << addr.to_hex();
-    return;
+    return td::Status::Error(PSTRING() << "received data from block " << blkid.to_str()
+                                       << " that cannot contain requested account " << workchain << ":"
+                                       << addr.to_hex());
   }
   Ref<vm::Cell> root;
   if (!transaction.empty()) {
     auto R = vm::std_boc_deserialize(std::move(transaction));
     if (R.is_error()) {
-      LOG(ERROR) << "cannot deserialize transaction";
-      return;
+      return td::Status::Error("cannot deserialize transaction");
     }
     root = R.move_as_ok();
     CHECK(root.not_null());
   }
   auto P = vm::std_boc_deserialize(std::move(proof));
   if (P.is_error()) {
-    LOG(ERROR) << "cannot deserialize block transaction proof";
-    return;
+    return td::Status::Error("cannot deserialize block transaction proof");
   }
   auto proof_root = P.move_as_ok();
   try {
     auto block_root = vm::MerkleProof::virtualize(std::move(proof_root), 1);
     if (block_root.is_null()) {
-      LOG(ERROR) << "transaction block proof is invalid";
-      return;
+      return td::Status::Error("transaction block proof is invalid");
     }
     auto res1 = check_block_header_proof(block_root, blkid);
     if (res1.is_error()) {
-      LOG(ERROR) << "error in transaction block header proof : " << res1.move_as_error().to_string();
-      return;
-    }
-    auto trans_root_res = block::get_block_transaction_try(std::move(block_root), workchain, addr, trans_lt);
-    if (trans_root_res.is_error()) {
-      LOG(ERROR) << trans_root_res.move_as_error().message();
-      return;
+      return res1.move_as_error_prefix("error in transaction block header proof : ");
     }
-    auto trans_root = trans_root_res.move_as_ok();
+    TRY_RESULT(trans_root, block::get_block_transaction_try(std::move(block_root), workchain, addr, trans_lt));
     if (trans_root.is_null() && root.not_null()) {
-      LOG(ERROR) << "error checking transaction proof: proof claims there is no such transaction, but we have got "
-                    "transaction data with hash "
-                 << root->get_hash().bits().to_hex(256);
-      return;
+      return td::Status::Error(PSTRING()
+                               << "error checking transaction proof: proof claims there is no such transaction, but "
+                                  "we have got transaction data with hash "
+                               << root->get_hash().bits().to_hex(256));
     }
     if (trans_root.not_null() && root.is_null()) {
-      LOG(ERROR) << "error checking transaction proof: proof claims there is such a transaction with hash "
-                 << trans_root->get_hash().bits().to_hex(256)
-                 << ", but we have got no "
-                    "transaction data";
-      return;
+      return td::Status::Error(PSTRING()
+                               << "error checking transaction proof: proof claims there is such a transaction with hash "
+                               << trans_root->get_hash().bits().to_hex(256) << ", but we have got no transaction data");
     }
     if (trans_root.not_null() && trans_root->get_hash().bits().compare(root->get_hash().bits(), 256)) {
-      LOG(ERROR) << "transaction hash mismatch: Merkle proof expects " << trans_root->get_hash().bits().to_hex(256)
-                 << " but received data has " << root->get_hash().bits().to_hex(256);
-      return;
+      return td::Status::Error(PSTRING() << "transaction hash mismatch: Merkle proof expects "
+                                         << trans_root->get_hash().bits().to_hex(256) << " but received data has "
+                                         << root->get_hash().bits().to_hex(256));
     }
   } catch (vm::VmError err) {
-    LOG(ERROR) << "error while traversing block transaction proof : " << err.get_msg();
-    return;
+    return td::Status::Error(PSTRING() << "error while traversing block transaction proof : " << err.get_msg());
   } catch (vm::VmVirtError err) {
-    LOG(ERROR) << "virtualization error while traversing block transaction proof : " << err.get_msg();
+    return td::Status::Error(PSTRING() << "virtualization error while traversing block transaction proof : "
+                                       << err.get_msg());
+  }
+  return root;
+}
+
+void TestNode::got_one_transaction(ton::BlockIdExt req_blkid, ton::BlockIdExt blkid, td::BufferSlice proof,
+                                   td::BufferSlice transaction, ton::WorkchainId workchain, ton::StdSmcAddress addr,
+                                   ton::LogicalTime trans_lt, bool dump) {
+  LOG(INFO) << "got transaction " << trans_lt << " for " << workchain << ":" << addr.to_hex()
+            << " with respect to block " << blkid.to_str();
+  auto R = check_one_transaction(req_blkid, blkid, std::move(proof), std::move(transaction), workchain, addr, trans_lt);
+  if (R.is_error()) {
+    LOG(ERROR) << R.move_as_error().message();
     return;
   }
+  auto root = R.move_as_ok();
   auto out = td::TerminalIO::out();
   if (root.is_null()) {
     out << "transaction not found" << std::endl;
@@ -1157,40 +1249,63 @@ std::string message_info_str(Ref<vm::Cell> msg, int mode) {
   }
 }
 
-void TestNode::got_last_transactions(std::vector<ton::BlockIdExt> blkids, td::BufferSlice transactions_boc,
-                                     ton::WorkchainId workchain, ton::StdSmcAddress addr, ton::LogicalTime lt,
-                                     ton::Bits256 hash, unsigned count, bool dump) {
-  LOG(INFO) << "got up to " << count << " transactions for " << workchain << ":" << addr.to_hex()
-            << " from last transaction " << lt << ":" << hash.to_hex();
+td::Result<std::vector<Ref<vm::Cell>>> TestNode::check_transaction_list(const std::vector<ton::BlockIdExt>& blkids,
+                                                                      td::BufferSlice transactions_boc,
+                                                                      ton::LogicalTime lt, ton::Bits256 hash,
+                                                                      unsigned count) {
   auto R = vm::std_boc_deserialize_multi(std::move(transactions_boc));
   if (R.is_error()) {
-    LOG(ERROR) << "cannot deserialize transactions BoC";
-    return;
+    return td::Status::Error("cannot deserialize transactions BoC");
   }
   auto list = R.move_as_ok();
   auto n = list.size();
   if (n > count) {
-    LOG(ERROR) << "obtained " << n << " transaction, but only " << count << " have been requested";
-    return;
+    return td::Status::Error(PSTRING() << "obtained " << n << " transaction, but only " << count
+                                       << " have been requested");
   }
   if (n != blkids.size()) {
-    LOG(ERROR) << "transaction list size " << n << " must be equal to the size of block id list " << blkids.size();
-    return;
+    return td::Status::Error(PSTRING() << "transaction list size " << n
+                                       << " must be equal to the size of block id list " << blkids.size());
   }
-  auto out = td::TerminalIO::out();
   unsigned c = 0;
   for (auto& root : list) {
-    const auto& blkid = blkids[c++];
+    c++;
     if (root.is_null()) {
-      out << "transaction #" << c << " from block " << blkid.to_str() << " not found" << std::endl;
-      LOG(ERROR) << "transactions are expected to be non-empty";
-      return;
+      return td::Status::Error(PSTRING() << "transaction #" << c << " from block " << blkids[c - 1].to_str()
+                                         << " not found, transactions are expected to be non-empty");
     }
     if (hash != root->get_hash().bits()) {
-      LOG(ERROR) << "transaction hash mismatch: expected " << hash.to_hex() << ", found "
-                 << root->get_hash().bits().to_hex(256);
-      return;
+      return td::Status::Error(PSTRING() << "transaction hash mismatch: expected " << hash.to_hex() << ", found "
+                                         << root->get_hash().bits().to_hex(256));
+    }
+    block::gen::Transaction::Record trans;
+    if (!tlb::unpack_cell(root, trans)) {
+      return td::Status::Error(PSTRING() << "cannot unpack transaction #" << c);
     }
+    if (trans.lt != lt) {
+      return td::Status::Error(PSTRING() << "transaction lt mismatch: expected " << lt << ", found " << trans.lt);
+    }
+    lt = trans.prev_trans_lt;
+    hash = trans.prev_trans_hash;
+  }
+  return list;
+}
+
+void TestNode::got_last_transactions(std::vector<ton::BlockIdExt> blkids, td::BufferSlice transactions_boc,
+                                     ton::WorkchainId workchain, ton::StdSmcAddress addr, ton::LogicalTime lt,
+                                     ton::Bits256 hash, unsigned count, bool dump) {
+  LOG(INFO) << "got up to " << count << " transactions for " << workchain << ":" << addr.to_hex()
+            << " from last transaction " << lt << ":" << hash.to_hex();
+  auto R = check_transaction_list(blkids, std::move(transactions_boc), lt, hash, count);
+  if (R.is_error()) {
+    LOG(ERROR) << R.move_as_error().message();
+    return;
+  }
+  auto list = R.move_as_ok();
+  auto out = td::TerminalIO::out();
+  unsigned c = 0;
+  for (auto& root : list) {
+    const auto& blkid = blkids[c++];
     out << "transaction #" << c << " from block " << blkid.to_str() << (dump ? " is " : "\n");
     if (dump) {
       std::ostringstream outp;
@@ -1199,14 +1314,7 @@ void TestNode::got_last_transactions(std::vector<ton::BlockIdExt> blkids, td::Bu
       out << outp.str();
     }
     block::gen::Transaction::Record trans;
-    if (!tlb::unpack_cell(root, trans)) {
-      LOG(ERROR) << "cannot unpack transaction #" << c;
-      return;
-    }
-    if (trans.lt != lt) {
-      LOG(ERROR) << "transaction lt mismatch: expected " << lt << ", found " << trans.lt;
-      return;
-    }
+    CHECK(tlb::unpack_cell(root, trans));
     lt = trans.prev_trans_lt;
     hash = trans.prev_trans_hash;
     out << "  time=" << trans.now << " outmsg_cnt=" << trans.outmsg_cnt << std::endl;
@@ -1250,6 +1358,9 @@ bool TestNode::get_all_shards(bool use_last, ton::BlockIdExt blkid) {
   if (!blkid.is_masterchain()) {
     return set_error("only masterchain blocks contain shard configuration");
   }
+  if (last_state_.root.not_null() && last_state_.blkid == blkid) {
+    return show_loaded_all_shards();
+  }
   if (!(ready_ && !client_.empty())) {
     return set_error("server connection not ready");
   }
@@ -1281,32 +1392,54 @@ void TestNode::got_all_shards(ton::BlockIdExt blk, td::BufferSlice proof, td::Bu
       LOG(ERROR) << "cannot deserialize shard configuration";
       return;
     }
-    auto root = R.move_as_ok();
-    auto out = td::TerminalIO::out();
-    out << "shard configuration is ";
-    std::ostringstream outp;
-    block::gen::t_ShardHashes.print_ref(outp, root);
-    vm::load_cell_slice(root).print_rec(outp);
-    out << outp.str();
-    block::ShardConfig sh_conf;
-    if (!sh_conf.unpack(vm::load_cell_slice_ref(root))) {
-      out << "cannot extract shard block list from shard configuration\n";
-    } else {
-      auto ids = sh_conf.get_shard_hash_ids(true);
-      int cnt = 0;
-      for (auto id : ids) {
-        auto ref = sh_conf.get_shard_hash(ton::ShardIdFull(id));
-        if (ref.not_null()) {
-          register_blkid(ref->top_block_id());
-          out << "shard #" << ++cnt << " : " << ref->top_block_id().to_str() << " @ " << ref->created_at() << " lt "
-              << ref->start_lt() << " .. " << ref->end_lt() << std::endl;
-        } else {
-          out << "shard #" << ++cnt << " : " << id.to_str() << " (cannot unpack)\n";
-        }
+    show_all_shards(R.move_as_ok());
+  }
+  show_new_blkids();
+}
+
+void TestNode::show_all_shards(Ref<vm::Cell> root) {
+  auto out = td::TerminalIO::out();
+  out << "shard configuration is ";
+  std::ostringstream outp;
+  block::gen::t_ShardHashes.print_ref(outp, root);
+  vm::load_cell_slice(root).print_rec(outp);
+  out << outp.str();
+  block::ShardConfig sh_conf;
+  if (!sh_conf.unpack(vm::load_cell_slice_ref(root))) {
+    out << "cannot extract shard block list from shard configuration\n";
+  } else {
+    auto ids = sh_conf.get_shard_hash_ids(true);
+    int cnt = 0;
+    for (auto id : ids) {
+      auto ref = sh_conf.get_shard_hash(ton::ShardIdFull(id));
+      if (ref.not_null()) {
+        register_blkid(ref->top_block_id());
+        out << "shard #" << ++cnt << " : " << ref->top_block_id().to_str() << " @ " << ref->created_at() << " lt "
+            << ref->start_lt() << " .. " << ref->end_lt() << std::endl;
+      } else {
+        out << "shard #" << ++cnt << " : " << id.to_str() << " (cannot unpack)\n";
       }
     }
   }
+}
+
+// the shard configuration is read from the loaded masterchain state (McStateExtra.shard_hashes)
+bool TestNode::show_loaded_all_shards() {
+  LOG(INFO) << "reading shard configuration from the loaded state of " << last_state_.blkid.to_str();
+  try {
+    block::gen::ShardStateUnsplit::Record sstate;
+    block::gen::McStateExtra::Record extra;
+    if (!(tlb::unpack_cell(last_state_.root, sstate) && sstate.custom->size_refs() &&
+          tlb::unpack_cell(sstate.custom->prefetch_ref(), extra))) {
+      return set_error("cannot unpack masterchain state extra information");
+    }
+    // the same ShardHashes cell getAllShardsInfo returns
+    show_all_shards(vm::CellBuilder{}.append_cellslice(extra.shard_hashes).finalize());
+  } catch (vm::VmError err) {
+    return set_error(PSTRING() << "error while reading shard configuration from the loaded state : " << err.get_msg());
+  }
   show_new_blkids();
+  return true;
 }
 
 bool TestNode::get_block(ton::BlockIdExt blkid, bool dump) {
@@ -1340,6 +1473,12 @@ bool TestNode::get_block(ton::BlockIdExt blkid, bool dump) {
 
 bool TestNode::get_state(ton::BlockIdExt blkid, bool dump) {
   LOG(INFO) << "got state download request for " << blkid.to_str();
+  if (last_state_.root.not_null() && last_state_.blkid == blkid) {
+    LOG(INFO) << "state " << blkid.to_str() << " is already loaded";
+    show_state(last_state_, dump);
+    show_new_blkids();
+    return true;
+  }
   auto b = ton::serialize_tl_object(
       ton::create_tl_object<ton::ton_api::liteServer_getState>(ton::create_tl_block_id(blkid)), true);
   return envelope_send_query(
@@ -1434,49 +1573,53 @@ void TestNode::got_state(ton::BlockIdExt blkid, ton::RootHash root_hash, ton::Fi
     return;
   }
   register_blkid(blkid);
+  auto res = load_state(blkid, root_hash, fhash, std::move(data));
+  if (res.is_error()) {
+    LOG(ERROR) << "cannot load state " << blkid.to_str() << " : " << res.move_as_error().to_string();
+    return;
+  }
+  last_state_ = res.move_as_ok();
+  show_state(last_state_, dump);
+  show_new_blkids();
+}
+
+// With a db root the state is saved there and mapped back from the file, so the downloaded buffer is released
+// as soon as it is written and the cells are read lazily from the page cache. Without one (or if the file cannot
+// be saved) the cells are read lazily from the buffer, which is kept in memory.
+td::Result<TestNode::LoadedState> TestNode::load_state(ton::BlockIdExt blkid, ton::RootHash root_hash,
+                                                       ton::FileHash file_hash, td::BufferSlice data) {
+  td::Result<std::pair<Ref<vm::Cell>, std::shared_ptr<vm::StaticBagOfCellsDb>>> r_state;
   if (!db_root_.empty()) {
-    auto res = save_db_file(fhash, std::move(data));
-    if (res.is_error()) {
+    auto res = save_db_file(file_hash, data.clone());
+    if (res.is_ok()) {
+      data = {};
+      r_state = lazy_boc_load_file(block::compute_db_filename(db_root_ + '/', file_hash), file_hash.as_slice());
+    } else {
       LOG(ERROR) << "error saving state file: " << res.to_string();
     }
   }
+  if (!data.empty()) {
+    r_state = lazy_boc_deserialize(std::move(data));
+  }
+  TRY_RESULT_PREFIX(state, std::move(r_state), "cannot lazily deserialize state data : ");
+  ton::RootHash rhash{state.first->get_hash().bits()};
+  if (rhash != root_hash) {
+    return td::Status::Error("block state root hash mismatch: data has " + rhash.to_hex() + " , expected " +
+                             root_hash.to_hex());
+  }
+  return LoadedState{blkid, std::move(state.first), std::move(state.second)};
+}
+
+void TestNode::show_state(const LoadedState& state, bool dump) {
   if (dump) {
-    auto res = vm::std_boc_deserialize(data.clone());
-    if (res.is_error()) {
-      LOG(ERROR) << "cannot deserialize block data : " << res.move_as_error().to_string();
-      return;
-    }
-    auto root = res.move_as_ok();
-    ton::RootHash rhash{root->get_hash().bits()};
-    if (rhash != root_hash) {
-      LOG(ERROR) << "block state root hash mismatch: data has " << rhash.to_hex() << " , expected "
-                 << root_hash.to_hex();
-      return;
-    }
     auto out = td::TerminalIO::out();
     out << "shard state contents is ";
     std::ostringstream outp;
-    block::gen::t_ShardState.print_ref(outp, root);
-    vm::load_cell_slice(root).print_rec(outp);
+    block::gen::t_ShardState.print_ref(outp, state.root);
+    vm::load_cell_slice(state.root).print_rec(outp);
     out << outp.str();
-    show_state_header(blkid, std::move(root), 0xffff);
-  } else {
-    auto res = lazy_boc_deserialize(data.clone());
-    if (res.is_error()) {
-      LOG(ERROR) << "cannot lazily deserialize block data : " << res.move_as_error().to_string();
-      return;
-    }
-    auto pair = res.move_as_ok();
-    auto root = std::move(pair.first);
-    ton::RootHash rhash{root->get_hash().bits()};
-    if (rhash != root_hash) {
-      LOG(ERROR) << "block state root hash mismatch: data has " << rhash.to_hex() << " , expected "
-                 << root_hash.to_hex();
-      return;
-    }
-    show_state_header(blkid, std::move(root), 0xffff);
   }
-  show_new_blkids();
+  show_state_header(state.blkid, state.root, 0xffff);
 }
 
 bool TestNode::get_block_header(ton::BlockIdExt blkid, int mode) {
@@ -1582,6 +1725,78 @@ void TestNode::got_block_header(ton::BlockIdExt blkid, td::BufferSlice data, int
   show_new_blkids();
 }
 
+td::Status TestNode::check_cacheable_answer(td::Slice query, td::BufferSlice answer) {
+  td::TlParser parser(query);
+  switch (parser.fetch_int()) {
+    case ton::ton_api::liteServer_getBlock::ID: {
+      TRY_RESULT(q, ton::fetch_tl_object<ton::ton_api::liteServer_getBlock>(td::BufferSlice(query), true));
+      TRY_RESULT(f, ton::fetch_tl_object<ton::ton_api::liteServer_blockData>(std::move(answer), true));
+      auto blkid = ton::create_block_id(q->id_);
+      if (ton::create_block_id(f->id_) != blkid) {
+        return td::Status::Error("block id mismatch");
+      }
+      ton::FileHash fhash;
+      td::sha256(f->data_.as_slice(), fhash.as_slice());
+      if (fhash != blkid.file_hash) {
+        return td::Status::Error(PSTRING() << "file hash mismatch for block " << blkid.to_str());
+      }
+      return td::Status::OK();
+    }
+    case ton::ton_api::liteServer_getBlockHeader::ID: {
+      TRY_RESULT(q, ton::fetch_tl_object<ton::ton_api::liteServer_getBlockHeader>(td::BufferSlice(query), true));
+      TRY_RESULT(f, ton::fetch_tl_object<ton::ton_api::liteServer_blockHeader>(std::move(answer), true));
+      auto blkid = ton::create_block_id(q->id_);
+      if (ton::create_block_id(f->id_) != blkid) {
+        return td::Status::Error("block id mismatch");
+      }
+      TRY_RESULT(root, vm::std_boc_deserialize(std::move(f->header_proof_)));
+      try {
+        auto virt_root = vm::MerkleProof::virtualize(root, 1);
+        if (virt_root.is_null()) {
+          return td::Status::Error("block header proof is not a valid Merkle proof");
+        }
+        return check_block_header_proof(std::move(virt_root), blkid);
+      } catch (vm::VmError err) {
+        return td::Status::Error(PSTRING() << "error processing block header proof : " << err.get_msg());
+      } catch (vm::VmVirtError err) {
+        return td::Status::Error(PSTRING() << "error processing block header proof : " << err.get_msg());
+      }
+    }
+    case ton::ton_api::liteServer_getState::ID: {
+      TRY_RESULT(q, ton::fetch_tl_object<ton::ton_api::liteServer_getState>(td::BufferSlice(query), true));
+      TRY_RESULT(f, ton::fetch_tl_object<ton::ton_api::liteServer_blockState>(std::move(answer), true));
+      auto blkid = ton::create_block_id(q->id_);
+      if (ton::create_block_id(f->id_) != blkid) {
+        return td::Status::Error("block id mismatch");
+      }
+      // got_state and got_mc_state check the file and root hashes of every state answer, cached or not,
+      // so they are not computed here a second time on the actor thread
+      return td::Status::OK();
+    }
+    case ton::ton_api::liteServer_getOneTransaction::ID: {
+      TRY_RESULT(q, ton::fetch_tl_object<ton::ton_api::liteServer_getOneTransaction>(td::BufferSlice(query), true));
+      TRY_RESULT(f, ton::fetch_tl_object<ton::ton_api::liteServer_transactionInfo>(std::move(answer), true));
+      auto R = check_one_transaction(ton::create_block_id(q->id_), ton::create_block_id(f->id_), std::move(f->proof_),
+                                     std::move(f->transaction_), q->account_->workchain_,
+                                     ton::UInt256_2_Bits256(q->account_->id_), q->lt_);
+      return R.is_error() ? R.move_as_error() : td::Status::OK();
+    }
+    case ton::ton_api::liteServer_getTransactions::ID: {
+      TRY_RESULT(q, ton::fetch_tl_object<ton::ton_api::liteServer_getTransactions>(td::BufferSlice(query), true));
+      TRY_RESULT(f, ton::fetch_tl_object<ton::ton_api::liteServer_transactionList>(std::move(answer), true));
+      std::vector<ton::BlockIdExt> blkids;
+      for (auto& id : f->ids_) {
+        blkids.push_back(ton::create_block_id(std::move(id)));
+      }
+      auto R = check_transaction_list(blkids, std::move(f->transactions_), q->lt_, ton::UInt256_2_Bits256(q->hash_),
+                                      static_cast<unsigned>(q->count_));
+      return R.is_error() ? R.move_as_error() : td::Status::OK();
+    }
+    default:
+      return td::Status::Error("answer is not cacheable");
+  }
+}
+
 td::Result<td::UInt256> get_uint256(std::string str) {
   if (str.size() != 64) {
     return td::Status::Error("uint256 must have 64 bytes");
@@ -1608,6 +1823,7 @@ int main(int argc, char* argv[]) {
   td::set_default_failure_signal_handler();
 
   td::actor::ActorOwn<TestNode> x;
+  WebServerOptions web_options;
 
   td::OptionsParser p;
   p.set_description("Test Lite Client for TON Blockchain");
@@ -1649,6 +1865,73 @@ int main(int argc, char* argv[]) {
     td::actor::send_closure(x, &TestNode::set_liteserver_idx, idx);
     return td::Status::OK();
   });
+  p.add_option('p', "http-port", "port of the http server (default 8000)", [&](td::Slice arg) {
+    TRY_RESULT(port, td::to_integer_safe<td::uint16>(arg));
+    web_options.port = port;
+    return td::Status::OK();
+  });
+  p.add_option('t', "http-threads", "number of threads dispatching http requests (default 2)", [&](td::Slice arg) {
+    TRY_RESULT(threads, td::to_integer_safe<td::uint32>(arg));
+    if (threads == 0) {
+      return td::Status::Error("number of http threads must be positive");
+    }
+    web_options.dispatch_threads = threads;
+    return td::Status::OK();
+  });
+  p.add_option('m', "http-max-in-flight", "max number of http requests in flight, 503 above it (default 1024)",
+               [&](td::Slice arg) {
+                 TRY_RESULT(limit, td::to_integer_safe<td::uint32>(arg));
+                 web_options.max_in_flight = limit;
+                 return td::Status::OK();
+               });
+  p.add_option('a', "all-liteservers", "connect to all liteservers from the global config", [&]() {
+    td::actor::send_closure(x, &TestNode::set_all_liteservers, true);
+    return td::Status::OK();
+  });
+  p.add_option('n', "connections", "number of connections to each liteserver (default 1)", [&](td::Slice arg) {
+    TRY_RESULT(n, td::to_integer_safe<td::uint32>(arg));
+    if (n == 0) {
+      return td::Status::Error("number of connections must be positive");
+    }
+    td::actor::send_closure(x, &TestNode::set_connections_per_server, n);
+    return td::Status::OK();
+  });
+  p.add_option('b', "cache-size", "bytes of answers about fixed blocks kept in memory (default 64M)",
+               [&](td::Slice arg) {
+                 TRY_RESULT(bytes, td::to_integer_safe<td::uint64>(arg));
+                 td::actor::send_closure(x, &TestNode::set_cache_size, static_cast<std::size_t>(bytes));
+                 return td::Status::OK();
+               });
+  p.add_option('s', "cache-dir", "directory to keep answers evicted from memory in (in its answers/ subdirectory)", [&](td::Slice dir) {
+    td::actor::send_closure(x, &TestNode::set_cache_dir, dir.str());
+    return td::Status::OK();
+  });
+  p.add_option('S', "cache-dir-size", "bytes of answers kept in the cache directory (default 1G)",
+               [&](td::Slice arg) {
+                 TRY_RESULT(bytes, td::to_integer_safe<td::uint64>(arg));
+                 td::actor::send_closure(x, &TestNode::set_cache_dir_size, static_cast<std::size_t>(bytes));
+                 return td::Status::OK();
+               });
+  p.add_option('B', "batch-concurrency", "liteserver queries kept in flight by one /getaccounts request (default 16)",
+               [&](td::Slice arg) {
+                 TRY_RESULT(n, td::to_integer_safe<td::uint32>(arg));
+                 if (n == 0) {
+                   return td::Status::Error("batch concurrency must be positive");
+                 }
+                 td::actor::send_closure(x, &TestNode::set_batch_concurrency, n);
+                 return td::Status::OK();
+               });
+  p.add_option('g', "gas-limit",
+               "gas limit of a get-method run by runmethod or /runmethod (default 1000000, at most 10000000)",
+               [&](td::Slice arg) {
+                 TRY_RESULT(gas, td::to_integer_safe<td::int64>(arg));
+                 if (gas <= 0 || gas > TestNode::max_runmethod_gas_limit()) {
+                   return td::Status::Error(PSLICE() << "gas limit must be between 1 and "
+                                                     << TestNode::max_runmethod_gas_limit());
+                 }
+                 td::actor::send_closure(x, &TestNode::set_runmethod_gas_limit, gas);
+                 return td::Status::OK();
+               });
   p.add_option('d', "daemonize", "set SIGHUP", [&]() {
     td::set_signal_handler(td::SignalType::HangUp,
                            [](int sig) {
@@ -1685,7 +1968,7 @@ int main(int argc, char* argv[]) {
   });
 
   // web server thread
-  std::thread webserver = std::thread(TestNode::run_web_server, &scheduler, &x);
+  std::thread webserver = std::thread(TestNode::run_web_server, &scheduler, &x, web_options);
 
   // updater thread called 'last' command
   std::thread updater = std::thread(run_updater, &scheduler, &x);
@@ -11,7 +11,7 @@ void TestNode::get_account_state_web(std::string address, std::shared_ptr<HttpSe
     web_error_response(response, "must obtain last block information before making other queries");
     return;
   }
-  if (!(ready_ && !client_.empty())) {
+  if (client_.empty()) {
     web_error_response(response, "server connection not ready");
     return;
   }
@@ -51,10 +51,8 @@ void TestNode::got_account_state_web(ton::BlockIdExt blk, ton::BlockIdExt shard_
       return;
     }
     auto root = R.move_as_ok();
-    std::ostringstream outp;
-    block::gen::t_Account.print_ref(outp, root);
-    vm::load_cell_slice(root).print_rec(outp);
-
-    web_success_response(response, outp.str());
+    WebJsonWriter writer(std::move(response));
+    writer.builder().enter_object()(
+        "result", writer.json([&](std::ostream& os) { block::gen::t_Account.print_ref_json(os, root); }));
   }
 }
\ No newline at end of file
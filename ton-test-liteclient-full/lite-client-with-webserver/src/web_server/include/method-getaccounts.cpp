@@ -0,0 +1,170 @@
+// Answers /getaccounts: the states of many accounts with respect to one masterchain block.
+// At most `concurrency` queries are in flight at once. Every answer carries a proof of the shard configuration
+// in that masterchain block; it is checked once per shard block and then trusted for the rest of the batch.
+// Accounts are streamed into the response as their answers arrive, in arbitrary order.
+class AccountBatchQuery : public td::actor::Actor {
+ public:
+  struct Account {
+    std::string address;
+    // an address given as bare hex is a masterchain one, as in /getaccount and /runmethod
+    ton::WorkchainId workchain{ton::masterchainId};
+    ton::StdSmcAddress addr;
+  };
+
+  // the request body: a JSON array of account addresses
+  static td::Result<std::vector<Account>> parse_accounts(td::MutableSlice body) {
+    auto R = td::json_decode(body);
+    if (R.is_error() || R.ok().type() != td::JsonValue::Type::Array) {
+      return td::Status::Error("request body must be a JSON array of account addresses");
+    }
+    std::vector<Account> accounts;
+    for (auto& value : R.ok_ref().get_array()) {
+      Account account;
+      if (value.type() != td::JsonValue::Type::String ||
+          !TestNode::parse_account_addr(value.get_string().str(), account.workchain, account.addr)) {
+        return td::Status::Error("cannot parse account address");
+      }
+      account.address = value.get_string().str();
+      accounts.push_back(std::move(account));
+    }
+    return std::move(accounts);
+  }
+
+  AccountBatchQuery(td::actor::ActorId<TestNode> node, ton::BlockIdExt mc_blk, std::vector<Account> accounts,
+                    std::size_t concurrency, std::shared_ptr<HttpServer::Response> response)
+      : node_(node)
+      , mc_blk_(mc_blk)
+      , accounts_(std::move(accounts))
+      , concurrency_(std::max<std::size_t>(concurrency, 1))
+      , writer_(std::make_unique<WebJsonWriter>(std::move(response))) {
+  }
+
+  void start_up() override {
+    writer_->builder().string_builder() << "{\"result\":[";
+    writer_->flush(true);
+    while (sent_ < accounts_.size() && sent_ < concurrency_) {
+      send_next();
+    }
+    check_done();
+  }
+
+  void got_answer(std::size_t idx, td::Result<td::BufferSlice> R) {
+    auto& account = accounts_[idx];
+    auto res = R.is_ok() ? process_answer(account, R.move_as_ok()) : R.move_as_error();
+    auto& jb = writer_->builder();
+    if (done_++ > 0) {
+      jb.string_builder() << ',';
+    }
+    if (res.is_error()) {
+      jb.enter_value() << WebJsonWriter::object([&](td::JsonObjectScope& item) {
+        item("address", account.address);
+        item("error", res.error().message());
+      });
+    } else {
+      auto root = res.move_as_ok();
+      jb.enter_value() << WebJsonWriter::object([&](td::JsonObjectScope& item) {
+        item("address", account.address);
+        if (root.is_null()) {
+          item("account", td::JsonNull());
+        } else {
+          item("account", writer_->json([&](std::ostream& os) { block::gen::t_Account.print_ref_json(os, root); }));
+        }
+      });
+    }
+    writer_->flush(true);
+    if (sent_ < accounts_.size()) {
+      send_next();
+    }
+    check_done();
+  }
+
+ private:
+  td::actor::ActorId<TestNode> node_;
+  ton::BlockIdExt mc_blk_;
+  std::vector<Account> accounts_;
+  std::size_t concurrency_;
+  std::unique_ptr<WebJsonWriter> writer_;
+  std::size_t sent_ = 0;
+  std::size_t done_ = 0;
+  // shard blocks whose presence in mc_blk_ has already been proven
+  std::set<ton::BlockIdExt> proven_shard_blks_;
+
+  void send_next() {
+    auto idx = sent_++;
+    auto& account = accounts_[idx];
+    auto a = ton::create_tl_object<ton::ton_api::liteServer_accountId>(account.workchain,
+                                                                        ton::Bits256_2_UInt256(account.addr));
+    auto b = ton::serialize_tl_object(
+        ton::create_tl_object<ton::ton_api::liteServer_getAccountState>(ton::create_tl_block_id(mc_blk_), std::move(a)),
+        true);
+    auto P = td::PromiseCreator::lambda([SelfId = actor_id(this), idx](td::Result<td::BufferSlice> R) {
+      td::actor::send_closure(SelfId, &AccountBatchQuery::got_answer, idx, std::move(R));
+    });
+    td::actor::send_closure(node_, &TestNode::envelope_send_web, std::move(b), std::move(P),
+                            std::shared_ptr<HttpServer::Response>());
+  }
+
+  td::Result<Ref<vm::Cell>> process_answer(const Account& account, td::BufferSlice data) {
+    TRY_RESULT(f, ton::fetch_tl_object<ton::ton_api::liteServer_accountState>(std::move(data), true));
+    auto blk = ton::create_block_id(f->id_);
+    auto shard_blk = ton::create_block_id(f->shardblk_);
+    if (blk != mc_blk_) {
+      return td::Status::Error(PSTRING() << "obtained getAccountState() for a different reference block "
+                                         << blk.to_str());
+    }
+    if (!shard_blk.is_valid_full()) {
+      return td::Status::Error(PSTRING() << "shard block id " << shard_blk.to_str() << " in answer is invalid");
+    }
+    if (!ton::shard_contains(shard_blk.shard_full(), ton::extract_addr_prefix(account.workchain, account.addr))) {
+      return td::Status::Error(PSTRING() << "received data from shard block " << shard_blk.to_str()
+                                         << " that cannot contain requested account");
+    }
+    if (blk != shard_blk && !proven_shard_blks_.count(shard_blk)) {
+      TRY_STATUS(TestNode::check_shard_config_proof(blk, shard_blk, std::move(f->shard_proof_)));
+      proven_shard_blks_.insert(shard_blk);
+    }
+    Ref<vm::Cell> root;
+    if (!f->state_.empty()) {
+      auto R = vm::std_boc_deserialize(std::move(f->state_));
+      if (R.is_error()) {
+        return td::Status::Error("cannot deserialize account state");
+      }
+      root = R.move_as_ok();
+    }
+    ton::LogicalTime last_trans_lt;
+    ton::Bits256 last_trans_hash;
+    TRY_STATUS(TestNode::check_account_proof(shard_blk, std::move(f->proof_), root, account.workchain, account.addr,
+                                             last_trans_lt, last_trans_hash));
+    return root;
+  }
+
+  void check_done() {
+    if (done_ < accounts_.size()) {
+      return;
+    }
+    writer_->builder().string_builder() << "]}";
+    writer_.reset();
+    stop();
+  }
+};
+
+void TestNode::get_accounts_web(std::string body, std::shared_ptr<HttpServer::Response> response) {
+  auto R = AccountBatchQuery::parse_accounts(td::MutableSlice(body));
+  if (R.is_error()) {
+    web_error_response(response, R.error().message().str(), SimpleWeb::StatusCode::client_error_bad_request);
+    return;
+  }
+  auto accounts = R.move_as_ok();
+
+  if (!mc_last_id_.is_valid()) {
+    web_error_response(response, "must obtain last block information before making other queries");
+    return;
+  }
+  if (client_.empty()) {
+    web_error_response(response, "server connection not ready");
+    return;
+  }
+  td::actor::create_actor<AccountBatchQuery>("getaccounts", actor_id(this), mc_last_id_, std::move(accounts),
+                                             batch_concurrency_, std::move(response))
+      .release();
+}
@@ -62,18 +62,12 @@ void TestNode::got_block_web(ton::BlockIdExt blkid, td::BufferSlice data, bool d
     }
     //auto out = td::TerminalIO::out();
     //out << "block contents is ";
-    std::ostringstream block_data, vm_data, header_data;
-    block::gen::t_Block.print_ref(block_data, root);
-    vm::load_cell_slice(root).print_rec(vm_data);
-    give_block_header_description(header_data, blkid, std::move(root), 0xffff);
-
-
-    pt::ptree result;
-    result.put("block", block_data.str());
-    result.put("vm", vm_data.str());
-    result.put("header", header_data.str());
-
-    web_success_response(response, result);
+    WebJsonWriter writer(std::move(response));
+    writer.builder().enter_object()("result", WebJsonWriter::object([&](td::JsonObjectScope& result) {
+      result("block", writer.json([&](std::ostream& os) { block::gen::t_Block.print_ref_json(os, root); }));
+      result("header",
+             writer.text([&](std::ostream& os) { give_block_header_description(os, blkid, root, 0xffff); }));
+    }));
   } else {
     auto res = lazy_boc_deserialize(data.clone());
     if (res.is_error()) {
@@ -92,7 +86,7 @@ void TestNode::got_block_web(ton::BlockIdExt blkid, td::BufferSlice data, bool d
   }
 }
 
-bool TestNode::give_block_header_description(std::ostringstream& out, ton::BlockIdExt blkid, Ref<vm::Cell> root, int mode) {
+bool TestNode::give_block_header_description(std::ostream& out, ton::BlockIdExt blkid, Ref<vm::Cell> root, int mode) {
   ton::RootHash vhash{root->get_hash().bits()};
   if (vhash != blkid.root_hash) {
     LOG(ERROR) << " block header for block " << blkid.to_str() << " has incorrect root hash " << vhash.to_hex()
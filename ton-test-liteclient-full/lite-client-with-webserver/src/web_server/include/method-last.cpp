@@ -1,6 +1,6 @@
 bool TestNode::get_server_mc_block_id_web(std::shared_ptr<HttpServer::Response> response) {
   auto b = ton::serialize_tl_object(ton::create_tl_object<ton::ton_api::liteServer_getMasterchainInfo>(), true);
-  return envelope_send_query(std::move(b), [Self = actor_id(this), response](td::Result<td::BufferSlice> res)->void {
+  return envelope_send_web(std::move(b), [Self = actor_id(this), response](td::Result<td::BufferSlice> res)->void {
     if (res.is_error()) {
       web_error_response(response, "cannot get masterchain info from server");
       return;
@@ -15,5 +15,5 @@ bool TestNode::get_server_mc_block_id_web(std::shared_ptr<HttpServer::Response>
         web_success_response(response, blk_id.to_str());
       }
     }
-  });
+  }, response);
 }
\ No newline at end of file
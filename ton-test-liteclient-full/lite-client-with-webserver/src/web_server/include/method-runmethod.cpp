@@ -0,0 +1,230 @@
+// Runs get-methods of smart contracts locally (runmethod, /runmethod).
+// The account state is requested from the liteserver together with its proofs; once they are checked,
+// the code and data found in the state are run by the local TVM, so the result does not depend on trusting the server.
+// This TVM has no c7, so a get-method sees only its code (in c3), its persistent data (in c4) and the stack:
+// the arguments followed by the method id.
+
+td::Result<SmcState> TestNode::get_smc_state(Ref<vm::Cell> root) {
+  ton::Bits256 hash = root->get_hash().bits();
+  auto it = smc_states_.find(hash);
+  if (it != smc_states_.end()) {
+    smc_lru_.splice(smc_lru_.begin(), smc_lru_, it->second);
+    return it->second->second;
+  }
+  block::gen::Account::Record_account acc;
+  block::gen::AccountStorage::Record storage;
+  if (!(tlb::unpack_cell(root, acc) && tlb::csr_unpack(acc.storage, storage))) {
+    return td::Status::Error("cannot unpack account state");
+  }
+  block::gen::AccountState::Record_account_active active;
+  block::gen::StateInit::Record state_init;
+  if (!tlb::csr_unpack(storage.state, active)) {
+    return td::Status::Error("account is not active");
+  }
+  if (!tlb::csr_unpack(active.x, state_init)) {
+    return td::Status::Error("cannot unpack account code and data");
+  }
+  SmcState state{state_init.code->prefetch_ref(), state_init.data->prefetch_ref()};
+  if (state.code.is_null()) {
+    return td::Status::Error("account has no code");
+  }
+  if (smc_states_.size() >= max_smc_states()) {
+    smc_states_.erase(smc_lru_.back().first);
+    smc_lru_.pop_back();
+  }
+  smc_lru_.emplace_front(hash, state);
+  smc_states_.emplace(hash, smc_lru_.begin());
+  return state;
+}
+
+td::Result<SmcMethodResult> TestNode::run_smc_method_on(ton::BlockIdExt ref_blk, ton::WorkchainId workchain,
+                                                        ton::StdSmcAddress addr, long long method_id,
+                                                        std::vector<vm::StackEntry> args, td::BufferSlice answer) {
+  TRY_RESULT(f, ton::fetch_tl_object<ton::ton_api::liteServer_accountState>(std::move(answer), true));
+  auto blk = ton::create_block_id(f->id_);
+  auto shard_blk = ton::create_block_id(f->shardblk_);
+  if (blk != ref_blk) {
+    return td::Status::Error(PSTRING() << "obtained getAccountState() for a different reference block " << blk.to_str()
+                                       << " instead of requested " << ref_blk.to_str());
+  }
+  if (!shard_blk.is_valid_full()) {
+    return td::Status::Error(PSTRING() << "shard block id " << shard_blk.to_str() << " in answer is invalid");
+  }
+  if (!ton::shard_contains(shard_blk.shard_full(), ton::extract_addr_prefix(workchain, addr))) {
+    return td::Status::Error(PSTRING() << "received data from shard block " << shard_blk.to_str()
+                                       << " that cannot contain requested account");
+  }
+  if (blk != shard_blk) {
+    TRY_STATUS(check_shard_config_proof(blk, shard_blk, std::move(f->shard_proof_)));
+  }
+  Ref<vm::Cell> root;
+  if (!f->state_.empty()) {
+    auto R = vm::std_boc_deserialize(std::move(f->state_));
+    if (R.is_error()) {
+      return td::Status::Error("cannot deserialize account state");
+    }
+    root = R.move_as_ok();
+  }
+  ton::LogicalTime last_trans_lt;
+  ton::Bits256 last_trans_hash;
+  TRY_STATUS(
+      check_account_proof(shard_blk, std::move(f->proof_), root, workchain, addr, last_trans_lt, last_trans_hash));
+  if (root.is_null()) {
+    return td::Status::Error("account state is empty");
+  }
+  SmcState state;
+  try {
+    TRY_RESULT(smc_state, get_smc_state(std::move(root)));
+    state = std::move(smc_state);
+  } catch (const vm::VmError& err) {
+    return td::Status::Error(PSTRING() << "error while unpacking account state : " << err.get_msg());
+  } catch (const vm::VmVirtError& err) {
+    return td::Status::Error(PSTRING() << "virtualization error while unpacking account state : " << err.get_msg());
+  }
+
+  LOG(INFO) << "running get-method " << method_id << " of " << workchain << ":" << addr.to_hex() << " with gas limit "
+            << runmethod_gas_limit_;
+  Ref<vm::Stack> stack{true};
+  for (auto& arg : args) {
+    stack.write().push(std::move(arg));
+  }
+  stack.write().push_smallint(method_id);
+  vm::VmState vm{state.code, std::move(stack), vm::GasLimits{runmethod_gas_limit_}, 1, state.data};
+  SmcMethodResult res;
+  res.blk = blk;
+  // the code and data come from the proven state, which may still contain pruned branches;
+  // nothing thrown by the run may escape the actor
+  try {
+    res.exit_code = ~vm.run();
+  } catch (const vm::VmVirtError& err) {
+    res.exit_code = err.get_errno();
+  } catch (const std::exception& e) {
+    return td::Status::Error(PSTRING() << "error while running get-method : " << e.what());
+  } catch (...) {
+    return td::Status::Error("unknown error while running get-method");
+  }
+  res.gas_used = vm.get_gas_limits().gas_consumed();
+  res.stack = vm.get_stack_ref();
+  return res;
+}
+
+bool TestNode::run_smc_method(ton::WorkchainId workchain, ton::StdSmcAddress addr, ton::BlockIdExt ref_blkid,
+                              std::string method, std::vector<std::string> words) {
+  long long method_id;
+  std::vector<vm::StackEntry> args;
+  auto S = block::parse_smc_method_call(method, words, method_id, args);
+  if (S.is_error()) {
+    return set_error(std::move(S));
+  }
+  if (!ref_blkid.is_valid()) {
+    return set_error("must obtain last block information before making other queries");
+  }
+  if (!(ready_ && !client_.empty())) {
+    return set_error("server connection not ready");
+  }
+  auto a = ton::create_tl_object<ton::ton_api::liteServer_accountId>(workchain, ton::Bits256_2_UInt256(addr));
+  auto b = ton::serialize_tl_object(
+      ton::create_tl_object<ton::ton_api::liteServer_getAccountState>(ton::create_tl_block_id(ref_blkid), std::move(a)),
+      true);
+  LOG(INFO) << "requesting account state for " << workchain << ":" << addr.to_hex() << " with respect to "
+            << ref_blkid.to_str() << " to run get-method " << method_id;
+  return envelope_send_query(std::move(b), [Self = actor_id(this), workchain, addr, ref_blkid, method_id,
+                                            args = std::move(args)](td::Result<td::BufferSlice> R) mutable -> void {
+    if (R.is_error()) {
+      return;
+    }
+    td::actor::send_closure_later(Self, &TestNode::got_smc_method_state, ref_blkid, workchain, addr, method_id,
+                                  std::move(args), R.move_as_ok());
+  });
+}
+
+void TestNode::got_smc_method_state(ton::BlockIdExt ref_blk, ton::WorkchainId workchain, ton::StdSmcAddress addr,
+                                    long long method_id, std::vector<vm::StackEntry> args, td::BufferSlice answer) {
+  auto R = run_smc_method_on(ref_blk, workchain, addr, method_id, std::move(args), std::move(answer));
+  if (R.is_error()) {
+    LOG(ERROR) << R.error().message();
+    return;
+  }
+  auto res = R.move_as_ok();
+  auto out = td::TerminalIO::out();
+  out << "get-method " << method_id << " of " << workchain << ":" << addr.to_hex() << " with respect to "
+      << res.blk.to_str() << ": exit code " << res.exit_code << ", gas used " << res.gas_used << std::endl;
+  std::ostringstream os;
+  res.stack->dump(os);
+  out << "result: " << os.str();
+}
+
+void TestNode::run_smc_method_web(std::string address, std::string method, std::string args_str,
+                                  std::shared_ptr<HttpServer::Response> response) {
+  ton::WorkchainId workchain = ton::masterchainId;  // change to basechain later
+  ton::StdSmcAddress addr;
+  if (!TestNode::parse_account_addr(address, workchain, addr)) {
+    web_error_response(response, "cannot parse account address", SimpleWeb::StatusCode::client_error_bad_request);
+    return;
+  }
+  std::vector<std::string> words;
+  if (!args_str.empty()) {
+    for (auto word : td::full_split(td::Slice(args_str), ',')) {
+      words.push_back(word.str());
+    }
+  }
+  long long method_id;
+  std::vector<vm::StackEntry> args;
+  auto S = block::parse_smc_method_call(method, words, method_id, args);
+  if (S.is_error()) {
+    web_error_response(response, S.message().str(), SimpleWeb::StatusCode::client_error_bad_request);
+    return;
+  }
+
+  if (!mc_last_id_.is_valid()) {
+    web_error_response(response, "must obtain last block information before making other queries");
+    return;
+  }
+  // while the connection is being restored the query waits in the client queue, as for the other routes
+  if (client_.empty()) {
+    web_error_response(response, "server connection not ready");
+    return;
+  }
+
+  auto ref_blk = mc_last_id_;
+  auto a = ton::create_tl_object<ton::ton_api::liteServer_accountId>(workchain, ton::Bits256_2_UInt256(addr));
+  auto b = ton::serialize_tl_object(
+      ton::create_tl_object<ton::ton_api::liteServer_getAccountState>(ton::create_tl_block_id(ref_blk), std::move(a)),
+      true);
+  // errors are reported here rather than by envelope_send_web, so it gets no response
+  envelope_send_web(
+      std::move(b),
+      [Self = actor_id(this), ref_blk, workchain, addr, method_id, args = std::move(args),
+       response](td::Result<td::BufferSlice> R) mutable -> void {
+        if (R.is_error()) {
+          web_error_response(response, R.error().message().str());
+          return;
+        }
+        td::actor::send_closure_later(Self, &TestNode::got_smc_method_state_web, ref_blk, workchain, addr, method_id,
+                                      std::move(args), R.move_as_ok(), response);
+      },
+      std::shared_ptr<HttpServer::Response>());
+}
+
+void TestNode::got_smc_method_state_web(ton::BlockIdExt ref_blk, ton::WorkchainId workchain, ton::StdSmcAddress addr,
+                                        long long method_id, std::vector<vm::StackEntry> args, td::BufferSlice answer,
+                                        std::shared_ptr<HttpServer::Response> response) {
+  auto R = run_smc_method_on(ref_blk, workchain, addr, method_id, std::move(args), std::move(answer));
+  if (R.is_error()) {
+    web_error_response(response, R.error().message().str());
+    return;
+  }
+  auto res = R.move_as_ok();
+  WebJsonWriter writer(std::move(response));
+  writer.builder().enter_object()("result", WebJsonWriter::object([&](td::JsonObjectScope& o) {
+    o("blk", res.blk.to_str());
+    o("method_id", td::JsonLong(method_id));
+    o("exit_code", res.exit_code);
+    o("gas_used", td::JsonLong(res.gas_used));
+    std::vector<vm::StackEntry> entries;
+    for (int i = res.stack->depth(); i > 0; i--) {
+      entries.push_back((*res.stack)[i - 1]);
+    }
+    o("stack", block::SmcStackJson(entries));
+  }));
+}
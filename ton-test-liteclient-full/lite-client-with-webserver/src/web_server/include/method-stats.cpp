@@ -0,0 +1,32 @@
+void to_json(td::JsonValueScope& jv, const WebQueryStats& stats) {
+  auto jo = jv.enter_object();
+  jo("hits", td::JsonLong(stats.hits));
+  jo("misses", td::JsonLong(stats.misses));
+  jo("in_flight", td::JsonLong(stats.in_flight));
+}
+
+void to_json(td::JsonValueScope& jv, const ResponseCache::Stats& stats) {
+  auto jo = jv.enter_object();
+  jo("hits", td::JsonLong(stats.hits));
+  jo("disk_hits", td::JsonLong(stats.disk_hits));
+  jo("misses", td::JsonLong(stats.misses));
+  jo("entries", td::JsonLong(stats.entries));
+  jo("bytes", td::JsonLong(stats.bytes));
+  jo("disk_entries", td::JsonLong(stats.disk_entries));
+  jo("disk_bytes", td::JsonLong(stats.disk_bytes));
+}
+
+void TestNode::get_stats_web(std::shared_ptr<HttpServer::Response> response) {
+  auto query_stats = web_query_stats_;
+  query_stats.in_flight = web_queries_.size();
+  auto cache_stats = answer_cache_.stats();
+  prune_subscribers();
+  auto subscribers = subscribers_.size();
+
+  WebJsonWriter writer(std::move(response));
+  writer.builder().enter_object()("result", WebJsonWriter::object([&](td::JsonObjectScope& result) {
+    result("queries", td::ToJson(query_stats));
+    result("cache", td::ToJson(cache_stats));
+    result("subscribers", td::JsonLong(subscribers));
+  }));
+}
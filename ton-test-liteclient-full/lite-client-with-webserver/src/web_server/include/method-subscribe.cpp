@@ -0,0 +1,110 @@
+// Server-sent events about new masterchain blocks.
+// The updater thread is the only one polling the liteserver (see web_last); whenever it observes a new
+// masterchain block, the block id (and, for subscribers that asked for it, the shard list fetched once)
+// is pushed to every subscriber, so the load on the liteserver does not depend on the number of clients.
+
+static void send_web_event(WebSubscriber& subscriber, td::Slice event, td::Slice data) {
+  auto& response = *subscriber.response;
+  response << "event: " << event.str() << "\ndata: " << data.str() << "\n\n";
+  response.send([closed = subscriber.closed](const SimpleWeb::error_code& ec) {
+    if (ec) {
+      closed->store(true, std::memory_order_relaxed);
+    }
+  });
+}
+
+static std::string last_block_event(ton::BlockIdExt blkid) {
+  td::JsonBuilder jb(td::StringBuilder(td::MutableSlice(), true));
+  jb.enter_object()("last", blkid.to_str());
+  return jb.string_builder().as_cslice().str();
+}
+
+void TestNode::prune_subscribers() {
+  subscribers_.erase(std::remove_if(subscribers_.begin(), subscribers_.end(),
+                                    [](const WebSubscriber& subscriber) { return subscriber.closed->load(); }),
+                     subscribers_.end());
+}
+
+void TestNode::subscribe_web(bool shards, std::shared_ptr<HttpServer::Response> response) {
+  prune_subscribers();
+  if (subscribers_.size() >= max_subscribers()) {
+    web_error_response(response, "too many subscribers", SimpleWeb::StatusCode::server_error_service_unavailable);
+    return;
+  }
+  // the stream has no length and lasts until the client goes away
+  response->close_connection_after_response = true;
+  response->write({{"Content-Type", "text/event-stream"}, {"Cache-Control", "no-cache"}});
+  WebSubscriber subscriber{std::move(response), shards, std::make_shared<std::atomic<bool>>(false)};
+  if (mc_last_id_.is_valid()) {
+    send_web_event(subscriber, "block", last_block_event(mc_last_id_));
+  } else {
+    subscriber.response->send();
+  }
+  subscribers_.push_back(std::move(subscriber));
+}
+
+void TestNode::publish_last_block_web() {
+  prune_subscribers();
+  if (subscribers_.empty()) {
+    return;
+  }
+  auto event = last_block_event(mc_last_id_);
+  bool want_shards = false;
+  for (auto& subscriber : subscribers_) {
+    send_web_event(subscriber, "block", event);
+    want_shards |= subscriber.shards;
+  }
+  if (!want_shards) {
+    return;
+  }
+  auto blkid = mc_last_id_;
+  auto b = ton::serialize_tl_object(
+      ton::create_tl_object<ton::ton_api::liteServer_getAllShardsInfo>(ton::create_tl_block_id(blkid)), true);
+  envelope_send_web(std::move(b),
+                    [Self = actor_id(this), blkid](td::Result<td::BufferSlice> res) -> void {
+                      if (res.is_error()) {
+                        LOG(WARNING) << "cannot obtain shard configuration for " << blkid.to_str() << " : "
+                                     << res.move_as_error();
+                        return;
+                      }
+                      auto F = ton::fetch_tl_object<ton::ton_api::liteServer_allShardsInfo>(res.move_as_ok(), true);
+                      if (F.is_error()) {
+                        LOG(WARNING) << "cannot parse answer to liteServer.getAllShardsInfo";
+                        return;
+                      }
+                      auto f = F.move_as_ok();
+                      td::actor::send_closure(Self, &TestNode::got_all_shards_web, ton::create_block_id(f->id_),
+                                              std::move(f->data_));
+                    },
+                    std::shared_ptr<HttpServer::Response>());
+}
+
+void TestNode::got_all_shards_web(ton::BlockIdExt blk, td::BufferSlice data) {
+  std::vector<ton::BlockIdExt> shards;
+  if (!data.empty()) {
+    auto R = vm::std_boc_deserialize(std::move(data));
+    block::ShardConfig sh_conf;
+    if (R.is_error() || !sh_conf.unpack(vm::load_cell_slice_ref(R.move_as_ok()))) {
+      LOG(WARNING) << "cannot extract shard block list from shard configuration of " << blk.to_str();
+      return;
+    }
+    for (auto id : sh_conf.get_shard_hash_ids(true)) {
+      auto ref = sh_conf.get_shard_hash(ton::ShardIdFull(id));
+      if (ref.not_null()) {
+        shards.push_back(ref->top_block_id());
+      }
+    }
+  }
+  td::JsonBuilder jb(td::StringBuilder(td::MutableSlice(), true));
+  {
+    auto jo = jb.enter_object();
+    jo("block", blk.to_str());
+    jo("shards", td::json_array(shards, [](const ton::BlockIdExt& id) { return id.to_str(); }));
+  }
+  auto event = jb.string_builder().as_cslice();
+  for (auto& subscriber : subscribers_) {
+    if (subscriber.shards && !subscriber.closed->load()) {
+      send_web_event(subscriber, "shards", event);
+    }
+  }
+}
@@ -0,0 +1,185 @@
+#include "td/utils/JsonBuilder.h"
+
+#include <cstdio>
+#include <streambuf>
+
+// Writes a JSON answer straight into the HTTP response.
+// An answer smaller than chunk_size() goes out as is with Content-Length; a larger one is sent
+// with chunked transfer encoding as it is produced, so it is never held in memory as a whole.
+class WebJsonWriter {
+ public:
+  explicit WebJsonWriter(std::shared_ptr<HttpServer::Response> response,
+                         SimpleWeb::StatusCode code = SimpleWeb::StatusCode::success_ok)
+      : response_(std::move(response)), code_(code), jb_(td::StringBuilder(td::MutableSlice(), true)) {
+  }
+  WebJsonWriter(const WebJsonWriter&) = delete;
+  WebJsonWriter& operator=(const WebJsonWriter&) = delete;
+  ~WebJsonWriter() {
+    finish();
+  }
+
+  td::JsonBuilder& builder() {
+    return jb_;
+  }
+
+  // a value printed by f into a stream: either the text of a JSON string (e.g. a TL-B dump)
+  // or, with raw = true, a JSON value of its own (e.g. TLB::print_ref_json)
+  class Streamed : public td::Jsonable {
+   public:
+    Streamed(WebJsonWriter* writer, std::function<void(std::ostream&)> f, bool raw)
+        : writer_(writer), f_(std::move(f)), raw_(raw) {
+    }
+    void store(td::JsonValueScope* scope) const {
+      *scope << td::JsonRaw(td::Slice(raw_ ? "" : "\""));
+      {
+        StreamBuf buf(writer_, !raw_);
+        std::ostream os(&buf);
+        f_(os);
+      }
+      if (!raw_) {
+        writer_->jb_.string_builder() << '"';
+      }
+    }
+
+   private:
+    WebJsonWriter* writer_;
+    std::function<void(std::ostream&)> f_;
+    bool raw_;
+  };
+  Streamed text(std::function<void(std::ostream&)> f) {
+    return Streamed(this, std::move(f), false);
+  }
+  Streamed json(std::function<void(std::ostream&)> f) {
+    return Streamed(this, std::move(f), true);
+  }
+
+  // a JSON object whose fields are written by f
+  template <class F>
+  class Object : public td::Jsonable {
+   public:
+    explicit Object(F f) : f_(std::move(f)) {
+    }
+    void store(td::JsonValueScope* scope) const {
+      auto jo = scope->enter_object();
+      f_(jo);
+    }
+
+   private:
+    F f_;
+  };
+  template <class F>
+  static Object<F> object(F f) {
+    return Object<F>(std::move(f));
+  }
+
+  // sends the buffered part of the answer if there is enough of it, or anyway with force = true
+  void flush(bool force = false) {
+    if (force || jb_.string_builder().as_cslice().size() >= chunk_size()) {
+      send_chunk();
+    }
+  }
+
+  void finish() {
+    if (finished_) {
+      return;
+    }
+    finished_ = true;
+    auto& sb = jb_.string_builder();
+    CHECK(!sb.is_error());
+    if (!chunked_) {
+      response_->write(code_, sb.as_cslice().str(), {{"Content-Type", "application/json"}});
+      return;
+    }
+    send_chunk();
+    *response_ << "0\r\n\r\n";
+  }
+
+ private:
+  std::shared_ptr<HttpServer::Response> response_;
+  SimpleWeb::StatusCode code_;
+  td::JsonBuilder jb_;
+  bool chunked_ = false;
+  bool finished_ = false;
+
+  static constexpr std::size_t chunk_size() {
+    return 1 << 16;
+  }
+
+  void send_chunk() {
+    if (!chunked_) {
+      chunked_ = true;
+      response_->write(code_, {{"Content-Type", "application/json"}, {"Transfer-Encoding", "chunked"}});
+    }
+    auto& sb = jb_.string_builder();
+    auto data = sb.as_cslice();
+    if (data.empty()) {
+      return;
+    }
+    char size[32];
+    auto len = std::snprintf(size, sizeof(size), "%zx\r\n", data.size());
+    response_->write(size, len);
+    response_->write(data.data(), data.size());
+    response_->write("\r\n", 2);
+    response_->send();
+    sb.clear();
+  }
+
+  // appends everything written into it to the answer, escaped as the contents of a JSON string if asked to
+  class StreamBuf : public std::streambuf {
+   public:
+    StreamBuf(WebJsonWriter* writer, bool escape) : writer_(writer), escape_(escape) {
+    }
+
+   protected:
+    int_type overflow(int_type ch) override {
+      if (ch != traits_type::eof()) {
+        put(static_cast<char>(ch));
+        writer_->flush();
+      }
+      return ch;
+    }
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+      for (std::streamsize i = 0; i < n; i++) {
+        put(s[i]);
+      }
+      writer_->flush();
+      return n;
+    }
+
+   private:
+    WebJsonWriter* writer_;
+    bool escape_;
+
+    void put(char c) {
+      auto& sb = writer_->jb_.string_builder();
+      if (!escape_) {
+        sb << c;
+        return;
+      }
+      switch (c) {
+        case '"':
+          sb << '\\' << '"';
+          break;
+        case '\\':
+          sb << '\\' << '\\';
+          break;
+        case '\n':
+          sb << '\\' << 'n';
+          break;
+        case '\r':
+          sb << '\\' << 'r';
+          break;
+        case '\t':
+          sb << '\\' << 't';
+          break;
+        default:
+          // bytes of multibyte UTF-8 characters are copied as they are
+          if (static_cast<unsigned char>(c) <= 31) {
+            sb << td::JsonOneChar(static_cast<unsigned char>(c));
+          } else {
+            sb << c;
+          }
+      }
+    }
+  };
+};
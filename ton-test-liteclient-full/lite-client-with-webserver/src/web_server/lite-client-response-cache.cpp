@@ -0,0 +1,248 @@
+#include "block/block-db.h"
+#include "td/utils/misc.h"
+#include "td/utils/PathView.h"
+#include "td/utils/port/path.h"
+#include "td/utils/port/Stat.h"
+#include "td/utils/tl_parsers.h"
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+
+// Answers to liteserver queries about a fixed block (or a fixed transaction) never change,
+// so they are kept in memory up to a byte budget, least recently used first out.
+// With a spill directory, evicted answers are written into its "answers" subdirectory and read back on a memory miss;
+// that subdirectory has a byte budget of its own, and the least recently used answers are removed beyond it.
+// Only answers that passed TestNode::check_cacheable_answer are put here.
+class ResponseCache {
+ public:
+  struct Stats {
+    td::uint64 hits = 0;
+    td::uint64 disk_hits = 0;
+    td::uint64 misses = 0;
+    std::size_t bytes = 0;
+    std::size_t entries = 0;
+    std::size_t disk_bytes = 0;
+    std::size_t disk_entries = 0;
+  };
+
+  static bool is_cacheable(td::Slice query) {
+    if (query.size() < 4) {
+      return false;
+    }
+    td::TlParser parser(query);
+    switch (parser.fetch_int()) {
+      case ton::ton_api::liteServer_getBlock::ID:
+      case ton::ton_api::liteServer_getBlockHeader::ID:
+      case ton::ton_api::liteServer_getState::ID:
+      case ton::ton_api::liteServer_getOneTransaction::ID:
+      case ton::ton_api::liteServer_getTransactions::ID:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  void set_max_bytes(std::size_t max_bytes) {
+    max_bytes_ = max_bytes;
+    shrink();
+  }
+  void set_max_disk_bytes(std::size_t max_disk_bytes) {
+    max_disk_bytes_ = max_disk_bytes;
+    shrink_disk();
+  }
+  // the answers are spilled into an "answers" subdirectory the cache creates and owns; files left there
+  // by a previous run are kept, oldest first out, and files not named like spilled answers are never touched
+  void set_spill_dir(std::string dir) {
+    spill_dir_.clear();
+    disk_lru_.clear();
+    disk_map_.clear();
+    disk_bytes_ = 0;
+    if (dir.empty()) {
+      return;
+    }
+    if (dir.back() != '/') {
+      dir += '/';
+    }
+    spill_dir_ = dir + "answers/";
+    td::mkdir(spill_dir_, 0755).ignore();
+    std::vector<std::pair<td::uint64, DiskEntry>> files;
+    td::walk_path(spill_dir_, [&](td::CSlice name, bool is_directory) {
+      if (is_directory) {
+        return;
+      }
+      auto fname = spilled_filename(name);
+      if (fname.empty()) {
+        return;
+      }
+      auto r_stat = td::stat(name);
+      if (r_stat.is_ok()) {
+        auto stat = r_stat.move_as_ok();
+        files.emplace_back(stat.mtime_nsec_, DiskEntry{std::move(fname), static_cast<std::size_t>(stat.size_)});
+      }
+    }).ignore();
+    std::sort(files.begin(), files.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (auto& file : files) {
+      add_disk_entry(std::move(file.second));
+    }
+    shrink_disk();
+  }
+
+  bool get(td::Slice query, td::BufferSlice& answer) {
+    auto it = map_.find(query.str());
+    if (it != map_.end()) {
+      stats_.hits++;
+      lru_.splice(lru_.begin(), lru_, it->second);
+      answer = it->second->answer.clone();
+      return true;
+    }
+    if (!spill_dir_.empty()) {
+      auto disk_it = disk_map_.find(spill_filename(query));
+      if (disk_it != disk_map_.end()) {
+        auto R = block::load_binary_file(disk_it->first);
+        if (R.is_ok()) {
+          stats_.disk_hits++;
+          disk_lru_.splice(disk_lru_.begin(), disk_lru_, disk_it->second);
+          answer = R.move_as_ok();
+          put(query, answer.clone(), true);
+          return true;
+        }
+        remove_disk_entry(disk_it->second);
+      }
+    }
+    stats_.misses++;
+    return false;
+  }
+
+  void put(td::Slice query, td::BufferSlice answer) {
+    put(query, std::move(answer), false);
+  }
+
+  Stats stats() const {
+    auto res = stats_;
+    res.bytes = bytes_;
+    res.entries = map_.size();
+    res.disk_bytes = disk_bytes_;
+    res.disk_entries = disk_map_.size();
+    return res;
+  }
+
+ private:
+  struct Entry {
+    std::string query;
+    td::BufferSlice answer;
+    bool on_disk;
+  };
+  struct DiskEntry {
+    std::string fname;
+    std::size_t size;
+  };
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> map_;
+  std::size_t bytes_ = 0;
+  std::size_t max_bytes_ = 64 << 20;
+  std::string spill_dir_;
+  // files in the spill directory, keyed by file name
+  std::list<DiskEntry> disk_lru_;
+  std::unordered_map<std::string, std::list<DiskEntry>::iterator> disk_map_;
+  std::size_t disk_bytes_ = 0;
+  std::size_t max_disk_bytes_ = std::size_t{1} << 30;
+  Stats stats_;
+
+  static std::size_t entry_size(const Entry& entry) {
+    return entry.query.size() + entry.answer.size();
+  }
+
+  void put(td::Slice query, td::BufferSlice answer, bool on_disk) {
+    if (map_.count(query.str())) {
+      return;
+    }
+    if (query.size() + answer.size() > max_bytes_) {
+      if (!on_disk && !spill_dir_.empty()) {
+        spill(query, answer);
+      }
+      return;
+    }
+    lru_.push_front(Entry{query.str(), std::move(answer), on_disk});
+    map_.emplace(lru_.front().query, lru_.begin());
+    bytes_ += entry_size(lru_.front());
+    shrink();
+  }
+
+  void shrink() {
+    while (bytes_ > max_bytes_) {
+      auto& entry = lru_.back();
+      if (!entry.on_disk && !spill_dir_.empty()) {
+        spill(entry.query, entry.answer);
+      }
+      bytes_ -= entry_size(entry);
+      map_.erase(entry.query);
+      lru_.pop_back();
+    }
+  }
+
+  std::string spill_filename(td::Slice query) const {
+    return block::compute_db_filename(spill_dir_, block::compute_file_hash(query));
+  }
+
+  // the name spill() would give to the file at path, or an empty string if path is not such a file
+  std::string spilled_filename(td::CSlice path) const {
+    auto R = td::hex_decode(td::PathView(path).file_stem());
+    if (R.is_error() || R.ok().size() != 32) {
+      return {};
+    }
+    ton::FileHash hash;
+    hash.as_slice().copy_from(R.ok());
+    auto suffix = block::compute_db_filename("", hash);
+    if (!td::ends_with(path, suffix)) {
+      return {};
+    }
+    return block::compute_db_filename(spill_dir_, hash);
+  }
+
+  void add_disk_entry(DiskEntry entry) {
+    auto it = disk_map_.find(entry.fname);
+    if (it != disk_map_.end()) {
+      disk_bytes_ -= it->second->size;
+      disk_lru_.erase(it->second);
+      disk_map_.erase(it);
+    }
+    disk_bytes_ += entry.size;
+    disk_lru_.push_front(std::move(entry));
+    disk_map_.emplace(disk_lru_.front().fname, disk_lru_.begin());
+  }
+
+  void remove_disk_entry(std::list<DiskEntry>::iterator it) {
+    td::unlink(it->fname).ignore();
+    disk_bytes_ -= it->size;
+    disk_map_.erase(it->fname);
+    disk_lru_.erase(it);
+  }
+
+  void shrink_disk() {
+    while (disk_bytes_ > max_disk_bytes_) {
+      remove_disk_entry(std::prev(disk_lru_.end()));
+    }
+  }
+
+  void spill(td::Slice query, const td::BufferSlice& answer) {
+    if (answer.size() > max_disk_bytes_) {
+      return;
+    }
+    auto hash = block::compute_file_hash(query);
+    auto fname = spill_filename(query);
+    auto tmp_fname = block::compute_db_tmp_filename(spill_dir_, hash);
+    auto S = block::save_binary_file(tmp_fname, answer);
+    if (S.is_ok() && rename(tmp_fname.c_str(), fname.c_str()) < 0) {
+      S = td::Status::PosixError(errno, "cannot rename file");
+    }
+    if (S.is_error()) {
+      td::unlink(tmp_fname).ignore();
+      LOG(WARNING) << "cannot spill cached answer to " << fname << " : " << S;
+      return;
+    }
+    // a file rewritten for the same query replaces the old one in the index
+    add_disk_entry(DiskEntry{std::move(fname), answer.size()});
+    shrink_disk();
+  }
+};
@@ -1,8 +1,6 @@
-td::Result<std::pair<Ref<vm::Cell>, std::shared_ptr<vm::StaticBagOfCellsDb>>> lazy_boc_deserialize(
-    td::BufferSlice data) {
-  vm::StaticBagOfCellsDbLazy::Options options;
-  options.check_crc32c = true;
-  TRY_RESULT(boc, vm::StaticBagOfCellsDbLazy::create(vm::BufferSliceBlobView::create(std::move(data)), options));
+td::Result<std::pair<Ref<vm::Cell>, std::shared_ptr<vm::StaticBagOfCellsDb>>> lazy_boc_root(
+    td::Result<std::shared_ptr<vm::StaticBagOfCellsDb>> r_boc) {
+  TRY_RESULT(boc, std::move(r_boc));
   TRY_RESULT(rc, boc->get_root_count());
   if (rc != 1) {
     return td::Status::Error(-668, "bag-of-cells is not standard (exactly one root cell expected)");
@@ -11,6 +9,25 @@ td::Result<std::pair<Ref<vm::Cell>, std::shared_ptr<vm::StaticBagOfCellsDb>>> la
   return std::make_pair(std::move(root), std::move(boc));
 }
 
+td::Result<std::pair<Ref<vm::Cell>, std::shared_ptr<vm::StaticBagOfCellsDb>>> lazy_boc_deserialize(
+    td::BufferSlice data) {
+  vm::StaticBagOfCellsDbLazy::Options options;
+  options.check_crc32c = true;
+  return lazy_boc_root(vm::StaticBagOfCellsDbLazy::create(vm::BufferSliceBlobView::create(std::move(data)), options));
+}
+
+// cells are loaded from the mapped file on demand, so only the pages actually used are ever read into memory;
+// the crc32c is not checked for the same reason (the callers compare the file hash before saving the file)
+td::Result<std::pair<Ref<vm::Cell>, std::shared_ptr<vm::StaticBagOfCellsDb>>> lazy_boc_load_file(
+    std::string path, td::Slice file_hash) {
+  vm::StaticBagOfCellsDbLazy::Options options;
+  // a file without an embedded index is scanned once, its cell offsets are kept next to it
+  options.index_path = path + ".idx";
+  options.index_key = file_hash.str();
+  TRY_RESULT(blob, vm::FileMemoryMappingBlobView::create(path));
+  return lazy_boc_root(vm::StaticBagOfCellsDbLazy::create(std::move(blob), std::move(options)));
+}
+
 bool TestNode::parse_account_addr(std::string acc_string, ton::WorkchainId& wc, ton::StdSmcAddress& addr) {
   block::StdAddress a{acc_string};
   if (a.is_valid()) {
@@ -57,14 +74,21 @@ bool TestNode::parse_account_addr(std::string acc_string, ton::WorkchainId& wc,
 bool TestNode::envelope_send_web(td::BufferSlice query,
                                  td::Promise<td::BufferSlice> promise,
                                  std::shared_ptr<HttpServer::Response> response) {
-  if (!ready_ || client_.empty()) {
-    web_error_response(response, "failed to send query to server: not ready");
+  // while reconnecting the client holds the query until the connection is up or fails it quickly
+  // without a response (e.g. a part of a batch request) errors are reported through the promise only
+  if (client_.empty()) {
+    if (response) {
+      web_error_response(response, "failed to send query to server: not ready");
+    }
+    promise.set_error(td::Status::Error("failed to send query to server: not ready"));
     return false;
   }
   auto P = td::PromiseCreator::lambda([promise = std::move(promise), response](td::Result<td::BufferSlice> R) mutable {
     if (R.is_error()) {
       auto err = R.move_as_error();
-      web_error_response(response, "failed query");
+      if (response) {
+        web_error_response(response, "failed query");
+      }
       promise.set_error(std::move(err));
       return;
     }
@@ -73,19 +97,61 @@ bool TestNode::envelope_send_web(td::BufferSlice query,
     if (F.is_ok()) {
       auto f = F.move_as_ok();
       auto err = td::Status::Error(f->code_, f->message_);
-      web_error_response(response, "received error");
+      if (response) {
+        web_error_response(response, "received error");
+      }
       promise.set_error(std::move(err));
       return;
     }
     promise.set_result(std::move(data));
   });
+
+  td::BufferSlice cached;
+  if (ResponseCache::is_cacheable(query.as_slice()) && answer_cache_.get(query.as_slice(), cached)) {
+    P.set_value(std::move(cached));
+    return true;
+  }
+
+  // identical queries issued while one is in flight share its answer
+  auto key = query.as_slice().str();
+  auto it = web_queries_.find(key);
+  if (it != web_queries_.end()) {
+    web_query_stats_.hits++;
+    it->second.push_back(std::move(P));
+    return true;
+  }
+  web_query_stats_.misses++;
+  web_queries_[key].push_back(std::move(P));
+
+  auto Q = td::PromiseCreator::lambda([SelfId = actor_id(this), key](td::Result<td::BufferSlice> R) mutable {
+    td::actor::send_closure(SelfId, &TestNode::got_web_query_answer, std::move(key), std::move(R));
+  });
   td::BufferSlice b =
       ton::serialize_tl_object(ton::create_tl_object<ton::ton_api::liteServer_query>(std::move(query)), true);
   td::actor::send_closure(client_, &ton::AdnlExtClient::send_query, "query", std::move(b), td::Timestamp::in(10.0),
-                          std::move(P));
+                          std::move(Q));
   return true;
 }
 
+void TestNode::got_web_query_answer(std::string key, td::Result<td::BufferSlice> R) {
+  auto it = web_queries_.find(key);
+  CHECK(it != web_queries_.end());
+  auto promises = std::move(it->second);
+  web_queries_.erase(it);
+
+  if (R.is_ok() && ResponseCache::is_cacheable(key) &&
+      ton::fetch_tl_object<ton::ton_api::liteServer_error>(R.ok().clone(), true).is_error()) {
+    cache_answer(td::BufferSlice(key), R.ok().clone());
+  }
+  for (auto& promise : promises) {
+    if (R.is_ok()) {
+      promise.set_value(R.ok().clone());
+    } else {
+      promise.set_error(R.error().clone());
+    }
+  }
+}
+
 bool TestNode::get_server_mc_block_id_silent() {
   auto b = ton::serialize_tl_object(ton::create_tl_object<ton::ton_api::liteServer_getMasterchainInfo>(), true);
   return envelope_send_query(std::move(b), [Self = actor_id(this)](td::Result<td::BufferSlice> res) -> void {
@@ -119,5 +185,6 @@ void TestNode::got_server_mc_block_id_silent(ton::BlockIdExt blkid, ton::ZeroSta
     // request_state(blkid);
   } else if (mc_last_id_.id.seqno < blkid.id.seqno) {
     mc_last_id_ = blkid;
+    publish_last_block_web();
   }
 }
\ No newline at end of file
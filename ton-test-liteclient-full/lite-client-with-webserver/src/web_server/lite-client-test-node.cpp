@@ -3,20 +3,90 @@
 #include "ton/ton-types.h"
 #include "terminal/terminal.h"
 #include "vm/cells.h"
+#include "vm/stack.hpp"
+#include "vm/db/StaticBagOfCellsDb.h"
+#include "td/utils/port/thread.h"
 
 #include "server_http.hpp"
+#include "lite-client-response-cache.cpp"
 
-#include <boost/property_tree/ptree.hpp>
-#include <boost/property_tree/json_parser.hpp>
-
-// Short alias for this namespace
-namespace pt = boost::property_tree;
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
 
 using td::Ref;
 
 using HttpServer = SimpleWeb::Server<SimpleWeb::HTTP>;
 using td::Ref;
 
+#include "lite-client-json-writer.cpp"
+
+struct WebServerOptions {
+  unsigned short port = 8000;
+  std::size_t dispatch_threads = 2;
+  std::size_t max_in_flight = 1024;
+};
+
+struct WebQueryStats {
+  td::uint64 hits = 0;
+  td::uint64 misses = 0;
+  std::size_t in_flight = 0;
+};
+
+// a client of /subscribe; closed is set from the server thread once writing to it fails
+struct WebSubscriber {
+  std::shared_ptr<HttpServer::Response> response;
+  bool shards;
+  std::shared_ptr<std::atomic<bool>> closed;
+};
+
+// Hands HTTP requests over to the actor scheduler from a fixed set of threads.
+// A request counts as in flight until its response is sent; above max_in_flight new requests get 503.
+class WebDispatcher {
+ public:
+  using Task = std::function<void(std::shared_ptr<HttpServer::Response>)>;
+
+  WebDispatcher(td::actor::Scheduler* scheduler, const WebServerOptions& options);
+  ~WebDispatcher();
+
+  // with track = false the request does not take an in-flight slot (e.g. a long-lived subscription)
+  void dispatch(std::shared_ptr<HttpServer::Response> response, Task task, bool track = true);
+  std::size_t in_flight() const {
+    return in_flight_->load(std::memory_order_relaxed);
+  }
+
+ private:
+  td::actor::Scheduler* scheduler_;
+  std::size_t max_in_flight_;
+  // shared with the responses, which may outlive the dispatcher
+  std::shared_ptr<std::atomic<std::size_t>> in_flight_;
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::vector<std::function<void()>> pending_;
+  bool close_flag_ = false;
+  std::vector<td::thread> threads_;
+
+  void loop();
+};
+
+// code and data of a smart contract, as found in its account state
+struct SmcState {
+  Ref<vm::Cell> code;
+  Ref<vm::Cell> data;
+};
+
+// a get-method run locally over a proven account state
+struct SmcMethodResult {
+  ton::BlockIdExt blk;
+  int exit_code = 0;
+  long long gas_used = 0;
+  Ref<vm::Stack> stack;
+};
+
 class TestNode : public td::actor::Actor {
  private:
   std::string local_config_ = "ton-local.config";
@@ -27,6 +97,8 @@ class TestNode : public td::actor::Actor {
 
   bool readline_enabled_ = true;
   td::int32 liteserver_idx_ = -1;
+  bool all_liteservers_ = false;
+  td::uint32 connections_per_server_ = 1;
 
   bool ready_ = false;
   bool inited_ = false;
@@ -40,7 +112,16 @@ class TestNode : public td::actor::Actor {
   ton::BlockIdExt mc_last_id_;
 
   ton::BlockIdExt last_block_id_, last_state_id_;
-  td::BufferSlice last_block_data_, last_state_data_;
+  td::BufferSlice last_block_data_;
+
+  // a downloaded state; with a db root it is mapped from its file there, so lookups only load the pages they touch
+  struct LoadedState {
+    ton::BlockIdExt blkid;
+    Ref<vm::Cell> root;
+    std::shared_ptr<vm::StaticBagOfCellsDb> boc;
+  };
+  // the last state obtained by getstate/dumpstate or by request_state; getstate serves it again without a download
+  LoadedState last_state_;
 
   std::string line_;
   const char *parse_ptr_, *parse_end_;
@@ -49,6 +130,20 @@ class TestNode : public td::actor::Actor {
   std::vector<ton::BlockIdExt> known_blk_ids_;
   std::size_t shown_blk_ids_ = 0;
 
+  // web queries in flight, keyed by the serialized query; the promises wait for the same answer
+  std::map<std::string, std::vector<td::Promise<td::BufferSlice>>> web_queries_;
+  WebQueryStats web_query_stats_;
+  ResponseCache answer_cache_;
+  std::vector<WebSubscriber> subscribers_;
+  // liteserver queries a single batch request (/getaccounts) keeps in flight
+  std::size_t batch_concurrency_ = 16;
+  // code and data of the accounts whose get-methods were run, keyed by the hash of the account state;
+  // the least recently used one is evicted first
+  std::list<std::pair<ton::Bits256, SmcState>> smc_lru_;
+  std::map<ton::Bits256, std::list<std::pair<ton::Bits256, SmcState>>::iterator> smc_states_;
+  // gas limit of a get-method run locally (runmethod, /runmethod)
+  long long runmethod_gas_limit_ = 1000000;
+
   std::unique_ptr<ton::AdnlExtClient::Callback> make_callback();
 
   void run_init_queries();
@@ -68,13 +163,31 @@ class TestNode : public td::actor::Actor {
   void got_account_state(ton::BlockIdExt ref_blk, ton::BlockIdExt blk, ton::BlockIdExt shard_blk,
                          td::BufferSlice shard_proof, td::BufferSlice proof, td::BufferSlice state,
                          ton::WorkchainId workchain, ton::StdSmcAddress addr);
+  void show_account_state(Ref<vm::Cell> root, ton::LogicalTime last_trans_lt, ton::Bits256 last_trans_hash);
+  bool show_loaded_account_state(ton::WorkchainId workchain, ton::StdSmcAddress addr);
+  bool run_smc_method(ton::WorkchainId workchain, ton::StdSmcAddress addr, ton::BlockIdExt ref_blkid,
+                      std::string method, std::vector<std::string> words);
+  void got_smc_method_state(ton::BlockIdExt ref_blk, ton::WorkchainId workchain, ton::StdSmcAddress addr,
+                            long long method_id, std::vector<vm::StackEntry> args, td::BufferSlice answer);
+  td::Result<SmcMethodResult> run_smc_method_on(ton::BlockIdExt ref_blk, ton::WorkchainId workchain,
+                                                ton::StdSmcAddress addr, long long method_id,
+                                                std::vector<vm::StackEntry> args, td::BufferSlice answer);
+  td::Result<SmcState> get_smc_state(Ref<vm::Cell> root);
+  static constexpr std::size_t max_smc_states() {
+    return 1024;
+  }
   bool get_all_shards(bool use_last = true, ton::BlockIdExt blkid = {});
   void got_all_shards(ton::BlockIdExt blk, td::BufferSlice proof, td::BufferSlice data);
+  void show_all_shards(Ref<vm::Cell> root);
+  bool show_loaded_all_shards();
   bool get_block(ton::BlockIdExt blk, bool dump = false);
   void got_block(ton::BlockIdExt blkid, td::BufferSlice data, bool dump);
   bool get_state(ton::BlockIdExt blk, bool dump = false);
   void got_state(ton::BlockIdExt blkid, ton::RootHash root_hash, ton::FileHash file_hash, td::BufferSlice data,
                  bool dump);
+  td::Result<LoadedState> load_state(ton::BlockIdExt blkid, ton::RootHash root_hash, ton::FileHash file_hash,
+                                     td::BufferSlice data);
+  void show_state(const LoadedState& state, bool dump);
   bool get_block_header(ton::BlockIdExt blk, int mode);
   void got_block_header(ton::BlockIdExt blkid, td::BufferSlice data, int mode);
   bool show_block_header(ton::BlockIdExt blkid, Ref<vm::Cell> root, int mode);
@@ -112,9 +225,9 @@ class TestNode : public td::actor::Actor {
   bool show_new_blkids(bool all = false);
   bool complete_blkid(ton::BlockId partial_blkid, ton::BlockIdExt& complete_blkid) const;
 
-  static bool parse_account_addr(std::string acc_string, ton::WorkchainId& wc, ton::StdSmcAddress& addr);
-
  public:
+  // leaves wc as it is for an address given as bare hex
+  static bool parse_account_addr(std::string acc_string, ton::WorkchainId& wc, ton::StdSmcAddress& addr);
   void conn_ready() {
     LOG(ERROR) << "conn ready";
     ready_ = true;
@@ -140,6 +253,31 @@ class TestNode : public td::actor::Actor {
   void set_liteserver_idx(td::int32 idx) {
     liteserver_idx_ = idx;
   }
+  void set_all_liteservers(bool value) {
+    all_liteservers_ = value;
+  }
+  void set_connections_per_server(td::uint32 value) {
+    connections_per_server_ = value;
+  }
+  void set_cache_size(std::size_t bytes) {
+    answer_cache_.set_max_bytes(bytes);
+  }
+  void set_cache_dir(std::string dir) {
+    answer_cache_.set_spill_dir(std::move(dir));
+  }
+  void set_cache_dir_size(std::size_t bytes) {
+    answer_cache_.set_max_disk_bytes(bytes);
+  }
+  void set_batch_concurrency(std::size_t value) {
+    batch_concurrency_ = value;
+  }
+  // get-methods run on the actor thread, so a single run must not stall the other queries for long
+  static constexpr long long max_runmethod_gas_limit() {
+    return 10000000;
+  }
+  void set_runmethod_gas_limit(long long value) {
+    runmethod_gas_limit_ = std::min(value, max_runmethod_gas_limit());
+  }
   void set_update_on_demand(bool value) {
     update_on_demand_enabled_ = value;
   }
@@ -153,19 +291,52 @@ class TestNode : public td::actor::Actor {
 
   bool envelope_send_query(td::BufferSlice query, td::Promise<td::BufferSlice> promise);
   bool envelope_send_web(td::BufferSlice query, td::Promise<td::BufferSlice> promise, std::shared_ptr<HttpServer::Response> response);
+  void got_web_query_answer(std::string key, td::Result<td::BufferSlice> R);
+  void cache_answer(td::BufferSlice query, td::BufferSlice answer);
   void parse_line(td::BufferSlice data);
 
+  // proof checks shared by the console and the web methods
+  static td::Status check_shard_config_proof(ton::BlockIdExt blk, ton::BlockIdExt shard_blk,
+                                             td::BufferSlice shard_proof);
+  static td::Status check_account_proof(ton::BlockIdExt shard_blk, td::BufferSlice proof, Ref<vm::Cell> root,
+                                        ton::WorkchainId workchain, ton::StdSmcAddress addr,
+                                        ton::LogicalTime& last_trans_lt, ton::Bits256& last_trans_hash);
+  static td::Result<Ref<vm::Cell>> check_one_transaction(ton::BlockIdExt req_blkid, ton::BlockIdExt blkid,
+                                                         td::BufferSlice proof, td::BufferSlice transaction,
+                                                         ton::WorkchainId workchain, ton::StdSmcAddress addr,
+                                                         ton::LogicalTime trans_lt);
+  static td::Result<std::vector<Ref<vm::Cell>>> check_transaction_list(const std::vector<ton::BlockIdExt>& blkids,
+                                                                      td::BufferSlice transactions_boc,
+                                                                      ton::LogicalTime lt, ton::Bits256 hash,
+                                                                      unsigned count);
+  // the checks the consumers of a cacheable answer do, see ResponseCache
+  static td::Status check_cacheable_answer(td::Slice query, td::BufferSlice answer);
+
   // web server methods
   void get_server_time_web(std::shared_ptr<HttpServer::Response> response);
   void get_account_state_web(std::string address, std::shared_ptr<HttpServer::Response> response);
   void got_account_state_web(ton::BlockIdExt blk, ton::BlockIdExt shard_blk, td::BufferSlice shard_proof,
                              td::BufferSlice proof, td::BufferSlice state, ton::WorkchainId workchain,
                              ton::StdSmcAddress addr, std::shared_ptr<HttpServer::Response> response);
+  void get_accounts_web(std::string body, std::shared_ptr<HttpServer::Response> response);
+  void run_smc_method_web(std::string address, std::string method, std::string args,
+                          std::shared_ptr<HttpServer::Response> response);
+  void got_smc_method_state_web(ton::BlockIdExt ref_blk, ton::WorkchainId workchain, ton::StdSmcAddress addr,
+                                long long method_id, std::vector<vm::StackEntry> args, td::BufferSlice answer,
+                                std::shared_ptr<HttpServer::Response> response);
   void get_block_web(std::string blkid_str, std::shared_ptr<HttpServer::Response> response, bool dump = true);
   void got_block_web(ton::BlockIdExt blkid, td::BufferSlice data, bool dump, std::shared_ptr<HttpServer::Response> response);
-  bool give_block_header_description(std::ostringstream& out, ton::BlockIdExt blkid, Ref<vm::Cell> root, int mode);
+  bool give_block_header_description(std::ostream& out, ton::BlockIdExt blkid, Ref<vm::Cell> root, int mode);
 
   bool get_server_mc_block_id_web(std::shared_ptr<HttpServer::Response> response);
+  void get_stats_web(std::shared_ptr<HttpServer::Response> response);
+  void subscribe_web(bool shards, std::shared_ptr<HttpServer::Response> response);
+  void publish_last_block_web();
+  void got_all_shards_web(ton::BlockIdExt blk, td::BufferSlice data);
+  void prune_subscribers();
+  static constexpr std::size_t max_subscribers() {
+    return 4096;
+  }
 
   TestNode() {
   }
@@ -173,10 +344,12 @@ class TestNode : public td::actor::Actor {
   void run();
 
   // Web Server Methods
-  static void run_web_server(td::actor::Scheduler* scheduler, td::actor::ActorOwn<TestNode>* x);
-  static void web_error_response(std::shared_ptr<HttpServer::Response> response, std::string msg);
+  static void run_web_server(td::actor::Scheduler* scheduler, td::actor::ActorOwn<TestNode>* x,
+                             WebServerOptions options);
+  static void web_error_response(
+      std::shared_ptr<HttpServer::Response> response, std::string msg,
+      SimpleWeb::StatusCode code = SimpleWeb::StatusCode::server_error_internal_server_error);
   static void web_success_response(std::shared_ptr<HttpServer::Response> response, std::string msg);
-  static void web_success_response(std::shared_ptr<HttpServer::Response> response, pt::ptree root);
 
   void web_last(){
     get_server_mc_block_id_silent();
@@ -1,80 +1,180 @@
-void TestNode::web_error_response(std::shared_ptr<HttpServer::Response> response, std::string msg) {
-  pt::ptree root;
-  std::ostringstream oss;
-  root.put("error", msg);
-  pt::write_json(oss, root);
-  response -> write(SimpleWeb::StatusCode::server_error_internal_server_error,
-                    oss.str());
+void TestNode::web_error_response(std::shared_ptr<HttpServer::Response> response, std::string msg,
+                                  SimpleWeb::StatusCode code) {
+  WebJsonWriter writer(std::move(response), code);
+  writer.builder().enter_object()("error", msg);
 }
 
 void TestNode::web_success_response(std::shared_ptr<HttpServer::Response> response, std::string msg) {
-  pt::ptree root;
-  std::ostringstream oss;
-  root.put("result", msg);
-  pt::write_json(oss, root);
-  response -> write(oss.str());
+  WebJsonWriter writer(std::move(response));
+  writer.builder().enter_object()("result", msg);
 }
 
-void TestNode::web_success_response(std::shared_ptr<HttpServer::Response> response, pt::ptree result) {
-  pt::ptree root;
-  std::ostringstream oss;
-  root.put_child("result", result);
-  pt::write_json(oss, root);
-  response -> write(oss.str());
+WebDispatcher::WebDispatcher(td::actor::Scheduler* scheduler, const WebServerOptions& options)
+    : scheduler_(scheduler)
+    , max_in_flight_(options.max_in_flight)
+    , in_flight_(std::make_shared<std::atomic<std::size_t>>(0)) {
+  auto threads = std::max<std::size_t>(options.dispatch_threads, 1);
+  for (std::size_t i = 0; i < threads; i++) {
+    threads_.emplace_back([this] { loop(); });
+  }
 }
 
-void TestNode::run_web_server(td::actor::Scheduler* scheduler, td::actor::ActorOwn<TestNode>* x){
+WebDispatcher::~WebDispatcher() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    close_flag_ = true;
+  }
+  cond_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WebDispatcher::dispatch(std::shared_ptr<HttpServer::Response> response, Task task, bool track) {
+  if (!track) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_.push_back([task = std::move(task), response = std::move(response)]() mutable {
+        task(std::move(response));
+      });
+    }
+    cond_.notify_one();
+    return;
+  }
+  if (in_flight_->fetch_add(1, std::memory_order_relaxed) >= max_in_flight_) {
+    in_flight_->fetch_sub(1, std::memory_order_relaxed);
+    TestNode::web_error_response(std::move(response), "too many requests in flight",
+                                 SimpleWeb::StatusCode::server_error_service_unavailable);
+    return;
+  }
+
+  // the response is sent when its last reference is dropped, so the slot is released only after that
+  struct InFlightGuard {
+    std::shared_ptr<HttpServer::Response> response;
+    std::shared_ptr<std::atomic<std::size_t>> in_flight;
+    ~InFlightGuard() {
+      response.reset();
+      in_flight->fetch_sub(1, std::memory_order_relaxed);
+    }
+  };
+  auto guard = std::make_shared<InFlightGuard>();
+  guard->response = std::move(response);
+  guard->in_flight = in_flight_;
+  std::shared_ptr<HttpServer::Response> tracked(guard, guard->response.get());
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.push_back([task = std::move(task), tracked = std::move(tracked)]() mutable { task(std::move(tracked)); });
+  }
+  cond_.notify_one();
+}
+
+void WebDispatcher::loop() {
+  std::vector<std::function<void()>> tasks;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cond_.wait(lock, [&] { return close_flag_ || !pending_.empty(); });
+      if (pending_.empty()) {
+        return;
+      }
+      std::swap(tasks, pending_);
+    }
+    // one scheduler context for the whole batch
+    scheduler_ -> run_in_context([&] {
+      for (auto& task : tasks) {
+        task();
+      }
+    });
+    tasks.clear();
+  }
+}
+
+void TestNode::run_web_server(td::actor::Scheduler* scheduler, td::actor::ActorOwn<TestNode>* x,
+                              WebServerOptions options) {
   HttpServer server;
-  server.config.port = 8000;
+  server.config.port = options.port;
+  WebDispatcher dispatcher(scheduler, options);
 
   // get a time
-  server.resource["^/time$"]["GET"] = [scheduler, x](std::shared_ptr<HttpServer::Response> response,
-                                                     std::shared_ptr<HttpServer::Request> request) {
-
-    std::thread work_thread([response, scheduler, x] {
-      scheduler -> run_in_context([&] {
-        td::actor::send_closure(x -> get(), &TestNode::get_server_time_web, response);
-      });
+  server.resource["^/time$"]["GET"] = [&dispatcher, x](std::shared_ptr<HttpServer::Response> response,
+                                                       std::shared_ptr<HttpServer::Request> request) {
+    dispatcher.dispatch(std::move(response), [x](std::shared_ptr<HttpServer::Response> response) {
+      td::actor::send_closure(x -> get(), &TestNode::get_server_time_web, std::move(response));
     });
-    work_thread.detach();
   };
   //
 
   // get a account
-  server.resource["^/getaccount/(.+)$"]["GET"] = [scheduler, x](std::shared_ptr<HttpServer::Response> response,
-                                                                          std::shared_ptr<HttpServer::Request> request) {
+  server.resource["^/getaccount/(.+)$"]["GET"] = [&dispatcher, x](std::shared_ptr<HttpServer::Response> response,
+                                                                   std::shared_ptr<HttpServer::Request> request) {
     std::string address = request -> path_match[1].str();
+    dispatcher.dispatch(std::move(response), [x, address](std::shared_ptr<HttpServer::Response> response) {
+      td::actor::send_closure(x -> get(), &TestNode::get_account_state_web, address, std::move(response));
+    });
+  };
 
-    std::thread work_thread([response, scheduler, x, address] {
-      scheduler -> run_in_context([&] {
-        td::actor::send_closure(x -> get(), &TestNode::get_account_state_web, address, response);
-      });
+  // get many accounts at once, the body is a JSON array of addresses
+  server.resource["^/getaccounts$"]["POST"] = [&dispatcher, x](std::shared_ptr<HttpServer::Response> response,
+                                                               std::shared_ptr<HttpServer::Request> request) {
+    std::string body = request -> content.string();
+    dispatcher.dispatch(std::move(response), [x, body](std::shared_ptr<HttpServer::Response> response) {
+      td::actor::send_closure(x -> get(), &TestNode::get_accounts_web, body, std::move(response));
+    });
+  };
+
+  // run a get-method locally over the proven account state, e.g. /runmethod/<addr>/seqno?args=1,0x2
+  server.resource["^/runmethod/([^/]+)/([^/?]+)"]["GET"] = [&dispatcher, x](
+                                                             std::shared_ptr<HttpServer::Response> response,
+                                                             std::shared_ptr<HttpServer::Request> request) {
+    std::string address = request -> path_match[1].str();
+    std::string method = request -> path_match[2].str();
+    auto query = request -> parse_query_string();
+    auto it = query.find("args");
+    std::string args = it != query.end() ? it->second : std::string{};
+    dispatcher.dispatch(std::move(response), [x, address, method, args](std::shared_ptr<HttpServer::Response> response) {
+      td::actor::send_closure(x -> get(), &TestNode::run_smc_method_web, address, method, args, std::move(response));
     });
-    work_thread.detach();
   };
 
   // get a block
-  server.resource["^/getblock/(.+)$"]["GET"] = [scheduler, x](std::shared_ptr<HttpServer::Response> response,
-                                                                          std::shared_ptr<HttpServer::Request> request) {
+  server.resource["^/getblock/(.+)$"]["GET"] = [&dispatcher, x](std::shared_ptr<HttpServer::Response> response,
+                                                                 std::shared_ptr<HttpServer::Request> request) {
     std::string blkid_str = request -> path_match[1].str();
-    std::thread work_thread([response, scheduler, x, blkid_str] {
-      scheduler -> run_in_context([&] {
-        td::actor::send_closure(x -> get(), &TestNode::get_block_web, blkid_str, response, true);
-      });
+    dispatcher.dispatch(std::move(response), [x, blkid_str](std::shared_ptr<HttpServer::Response> response) {
+      td::actor::send_closure(x -> get(), &TestNode::get_block_web, blkid_str, std::move(response), true);
     });
-    work_thread.detach();
   };
 
   // get a last block
-  server.resource["^/last$"]["GET"] = [scheduler, x](std::shared_ptr<HttpServer::Response> response,
-                                                                          std::shared_ptr<HttpServer::Request> request) {
-    std::thread work_thread([response, scheduler, x] {
-      scheduler -> run_in_context([&] {
-        td::actor::send_closure(x -> get(), &TestNode::get_server_mc_block_id_web, response);
-      });
+  server.resource["^/last$"]["GET"] = [&dispatcher, x](std::shared_ptr<HttpServer::Response> response,
+                                                       std::shared_ptr<HttpServer::Request> request) {
+    dispatcher.dispatch(std::move(response), [x](std::shared_ptr<HttpServer::Response> response) {
+      td::actor::send_closure(x -> get(), &TestNode::get_server_mc_block_id_web, std::move(response));
     });
-    work_thread.detach();
   };
-  
+
+  // server-sent events about new masterchain blocks, with shard lists if asked for by ?shards=1
+  server.resource["^/subscribe$"]["GET"] = [&dispatcher, x](std::shared_ptr<HttpServer::Response> response,
+                                                            std::shared_ptr<HttpServer::Request> request) {
+    auto query = request -> parse_query_string();
+    auto it = query.find("shards");
+    bool shards = it != query.end() && it->second != "0";
+    dispatcher.dispatch(
+        std::move(response),
+        [x, shards](std::shared_ptr<HttpServer::Response> response) {
+          td::actor::send_closure(x -> get(), &TestNode::subscribe_web, shards, std::move(response));
+        },
+        false);
+  };
+
+  // get gateway counters
+  server.resource["^/stats$"]["GET"] = [&dispatcher, x](std::shared_ptr<HttpServer::Response> response,
+                                                        std::shared_ptr<HttpServer::Request> request) {
+    dispatcher.dispatch(std::move(response), [x](std::shared_ptr<HttpServer::Response> response) {
+      td::actor::send_closure(x -> get(), &TestNode::get_stats_web, std::move(response));
+    });
+  };
+
   server.start();
-}
\ No newline at end of file
+}
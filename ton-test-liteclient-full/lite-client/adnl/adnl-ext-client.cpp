@@ -1,6 +1,8 @@
 #include "adnl-ext-client.hpp"
 #include "adnl-ext-client.h"
 
+#include <algorithm>
+
 namespace ton {
 
 void AdnlExtClientImpl::alarm() {
@@ -35,6 +37,72 @@ void AdnlExtClientImpl::alarm() {
   }
 }
 
+void AdnlExtClientImpl::conn_stopped(td::actor::ActorId<AdnlExtConnection> conn) {
+  if (!conn_.empty() && conn_.get() == conn) {
+    callback_->on_stop_ready();
+    conn_.reset();
+    alarm_timestamp() = next_create_at_;
+    // answers to the sent queries would come over the closed connection only
+    std::set<AdnlQueryId> pending;
+    for (auto &q : pending_queries_) {
+      pending.insert(q.first);
+    }
+    for (auto it = out_queries_.begin(); it != out_queries_.end();) {
+      if (pending.count(it->first)) {
+        ++it;
+        continue;
+      }
+      td::actor::send_closure(it->second, &AdnlQuery::reject,
+                              td::Status::Error(ErrorCode::notready, "connection closed"));
+      it = out_queries_.erase(it);
+    }
+  }
+}
+
+void AdnlExtClientImpl::conn_ready(td::actor::ActorId<AdnlExtConnection> conn) {
+  LOG(ERROR) << "conn ready";
+  if (!conn_.empty() && conn_.get() == conn) {
+    auto pending = std::move(pending_queries_);
+    pending_queries_.clear();
+    for (auto &q : pending) {
+      // skip queries that timed out while waiting
+      if (out_queries_.count(q.first)) {
+        send_to_connection(q.first, std::move(q.second));
+      }
+    }
+    callback_->on_ready();
+  }
+}
+
+void AdnlExtClientImpl::send_query(std::string name, td::BufferSlice data, td::Timestamp timeout,
+                                   td::Promise<td::BufferSlice> promise) {
+  if (conn_.empty() && pending_queries_.size() >= max_pending_queries()) {
+    // drop queries that timed out while waiting
+    pending_queries_.erase(std::remove_if(pending_queries_.begin(), pending_queries_.end(),
+                                          [&](const auto &q) { return out_queries_.count(q.first) == 0; }),
+                           pending_queries_.end());
+  }
+  if (conn_.empty() && pending_queries_.size() >= max_pending_queries()) {
+    promise.set_error(td::Status::Error(ErrorCode::notready, "not connected, too many queries waiting"));
+    return;
+  }
+  auto P = [SelfId = actor_id(this)](AdnlQueryId id) {
+    td::actor::send_closure(SelfId, &AdnlExtClientImpl::destroy_query, id);
+  };
+  auto q_id = generate_next_query_id();
+  out_queries_.emplace(q_id, AdnlQuery::create(std::move(promise), std::move(P), name, timeout, q_id));
+  if (!conn_.empty()) {
+    send_to_connection(q_id, std::move(data));
+  } else {
+    pending_queries_.emplace_back(q_id, std::move(data));
+  }
+}
+
+void AdnlExtClientImpl::send_to_connection(AdnlQueryId q_id, td::BufferSlice data) {
+  auto obj = create_tl_object<ton_api::adnl_message_query>(q_id, std::move(data));
+  td::actor::send_closure(conn_, &AdnlOutboundConnection::send, serialize_tl_object(obj, true));
+}
+
 void AdnlExtClientImpl::check_ready(td::Promise<td::Unit> promise) {
   if (conn_.empty() || !conn_.is_alive()) {
     promise.set_error(td::Status::Error(ErrorCode::notready, "not ready"));
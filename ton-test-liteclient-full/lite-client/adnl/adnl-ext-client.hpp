@@ -70,32 +70,11 @@ class AdnlExtClientImpl : public AdnlExtClient {
   void start_up() override {
     alarm_timestamp() = next_create_at_;
   }
-  void conn_stopped(td::actor::ActorId<AdnlExtConnection> conn) {
-    if (!conn_.empty() && conn_.get() == conn) {
-      callback_->on_stop_ready();
-      conn_.reset();
-      alarm_timestamp() = next_create_at_;
-    }
-  }
-  void conn_ready(td::actor::ActorId<AdnlExtConnection> conn) {
-    LOG(ERROR) << "conn ready";
-    if (!conn_.empty() && conn_.get() == conn) {
-      callback_->on_ready();
-    }
-  }
+  void conn_stopped(td::actor::ActorId<AdnlExtConnection> conn);
+  void conn_ready(td::actor::ActorId<AdnlExtConnection> conn);
   void check_ready(td::Promise<td::Unit> promise) override;
   void send_query(std::string name, td::BufferSlice data, td::Timestamp timeout,
-                  td::Promise<td::BufferSlice> promise) override {
-    auto P = [SelfId = actor_id(this)](AdnlQueryId id) {
-      td::actor::send_closure(SelfId, &AdnlExtClientImpl::destroy_query, id);
-    };
-    auto q_id = generate_next_query_id();
-    out_queries_.emplace(q_id, AdnlQuery::create(std::move(promise), std::move(P), name, timeout, q_id));
-    if (!conn_.empty()) {
-      auto obj = create_tl_object<ton_api::adnl_message_query>(q_id, std::move(data));
-      td::actor::send_closure(conn_, &AdnlOutboundConnection::send, serialize_tl_object(obj, true));
-    }
-  }
+                  td::Promise<td::BufferSlice> promise) override;
   void destroy_query(AdnlQueryId id) {
     out_queries_.erase(id);
   }
@@ -126,6 +105,14 @@ class AdnlExtClientImpl : public AdnlExtClient {
   td::Timestamp next_create_at_ = td::Timestamp::now_cached();
 
   std::map<AdnlQueryId, td::actor::ActorId<AdnlQuery>> out_queries_;
+  // queries issued while there is no connection, sent in conn_ready
+  std::vector<std::pair<AdnlQueryId, td::BufferSlice>> pending_queries_;
+
+  static constexpr size_t max_pending_queries() {
+    return 1024;
+  }
+
+  void send_to_connection(AdnlQueryId q_id, td::BufferSlice data);
 };
 
 }  // namespace ton
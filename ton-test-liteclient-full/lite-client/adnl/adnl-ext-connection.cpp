@@ -15,24 +15,29 @@ void AdnlExtConnection::send(td::BufferSlice data) {
     return;
   }
 
-  td::BufferSlice d{data.size() + 4 + 32 + 32};
-  auto S = d.as_slice();
-
-  S.copy_from(td::Slice(reinterpret_cast<const td::uint8 *>(&data_size), 4));
-  S.remove_prefix(4);
-  auto Sc = S;
-  td::Random::secure_bytes(S.copy().truncate(32));
-  S.remove_prefix(32);
-  S.copy_from(data.as_slice());
-  S.remove_prefix(data.size());
-
-  td::sha256(Sc.truncate(32 + data.size()), S);
-
-  td::BufferSlice e{d.size()};
-
-  out_ctr_.encrypt(d.as_slice(), e.as_slice());
-
-  buffered_fd_.output_buffer().append(std::move(e));
+  // the payload is encrypted in place and linked into the output buffer as is
+  // only the 36-byte header and the 32-byte checksum are written separately
+  char header[4 + 32];
+  td::MutableSlice H{header, sizeof(header)};
+  H.copy_from(td::Slice(reinterpret_cast<const td::uint8 *>(&data_size), 4));
+  auto nonce = H.substr(4);
+  td::Random::secure_bytes(nonce);
+
+  td::UInt256 checksum;
+  td::Sha256State sha;
+  sha.init();
+  sha.feed(nonce);
+  sha.feed(data.as_slice());
+  sha.extract(checksum.as_slice());
+
+  out_ctr_.encrypt(H, H);
+  out_ctr_.encrypt(data.as_slice(), data.as_slice());
+  out_ctr_.encrypt(checksum.as_slice(), checksum.as_slice());
+
+  auto &output = buffered_fd_.output_buffer();
+  output.append(H);
+  output.append(std::move(data));
+  output.append(checksum.as_slice());
   loop();
 }
 
@@ -70,13 +75,12 @@ td::Status AdnlExtConnection::receive(td::ChainBufferReader &input, bool &exit_l
     auto data = input.cut_head(len_).move_as_buffer_slice();
     update_timer();
 
-    td::BufferSlice dec_data{data.size()};
-    in_ctr_.encrypt(data.as_slice(), dec_data.as_slice());
+    in_ctr_.encrypt(data.as_slice(), data.as_slice());
 
     exit_loop = false;
     read_len_ = false;
     len_ = 0;
-    return receive_packet(std::move(dec_data));
+    return receive_packet(std::move(data));
   } else {
     if (input.size() < 256) {
       exit_loop = true;
@@ -28,6 +28,7 @@ class AdnlExtConnection : public td::actor::Actor, public td::ObserverBase {
   AdnlExtConnection(td::SocketFd fd, std::unique_ptr<Callback> callback, bool is_client)
       : buffered_fd_(std::move(fd)), callback_(std::move(callback)), is_client_(is_client) {
   }
+  // encrypts data in place, so the buffer must not be shared with anyone else
   void send(td::BufferSlice data);
   void send_uninit(td::BufferSlice data);
   td::Status receive(td::ChainBufferReader &input, bool &exit_loop);
@@ -0,0 +1,119 @@
+#include "adnl-ext-multi-client.hpp"
+
+namespace ton {
+
+void AdnlExtMultiClientImpl::start_up() {
+  class Cb : public AdnlExtClient::Callback {
+   public:
+    void on_ready() override {
+      td::actor::send_closure(id_, &AdnlExtMultiClientImpl::client_ready, idx_, true);
+    }
+    void on_stop_ready() override {
+      td::actor::send_closure(id_, &AdnlExtMultiClientImpl::client_ready, idx_, false);
+    }
+    Cb(td::actor::ActorId<AdnlExtMultiClientImpl> id, td::uint32 idx) : id_(id), idx_(idx) {
+    }
+
+   private:
+    td::actor::ActorId<AdnlExtMultiClientImpl> id_;
+    td::uint32 idx_;
+  };
+
+  for (auto &server : servers_) {
+    for (td::uint32 i = 0; i < connections_per_server_; i++) {
+      auto idx = static_cast<td::uint32>(clients_.size());
+      Client client;
+      client.client = AdnlExtClient::create(server.first, server.second, std::make_unique<Cb>(actor_id(this), idx));
+      clients_.push_back(std::move(client));
+    }
+  }
+}
+
+void AdnlExtMultiClientImpl::client_ready(td::uint32 idx, bool value) {
+  auto &client = clients_.at(idx);
+  if (client.ready == value) {
+    return;
+  }
+  client.ready = value;
+  if (value) {
+    if (ready_cnt_++ == 0) {
+      callback_->on_ready();
+    }
+  } else {
+    if (--ready_cnt_ == 0) {
+      callback_->on_stop_ready();
+    }
+  }
+}
+
+void AdnlExtMultiClientImpl::check_ready(td::Promise<td::Unit> promise) {
+  if (ready_cnt_ == 0) {
+    promise.set_error(td::Status::Error(ErrorCode::notready, "not ready"));
+    return;
+  }
+  promise.set_value(td::Unit());
+}
+
+td::int32 AdnlExtMultiClientImpl::choose_client() {
+  // least outstanding queries; the scan starts after the last chosen client to spread ties
+  // while nothing is ready, the query waits in the queue of some client until it reconnects
+  td::int32 best = -1;
+  auto n = static_cast<td::uint32>(clients_.size());
+  for (td::uint32 i = 0; i < n; i++) {
+    auto idx = (next_idx_ + i) % n;
+    auto &client = clients_[idx];
+    if ((client.ready || ready_cnt_ == 0) && (best < 0 || client.outstanding < clients_[best].outstanding)) {
+      best = static_cast<td::int32>(idx);
+    }
+  }
+  if (best >= 0) {
+    next_idx_ = static_cast<td::uint32>(best) + 1;
+  }
+  return best;
+}
+
+void AdnlExtMultiClientImpl::send_query(std::string name, td::BufferSlice data, td::Timestamp timeout,
+                                        td::Promise<td::BufferSlice> promise) {
+  do_send_query(std::move(name), std::move(data), timeout, std::move(promise), max_retries());
+}
+
+void AdnlExtMultiClientImpl::do_send_query(std::string name, td::BufferSlice data, td::Timestamp timeout,
+                                           td::Promise<td::BufferSlice> promise, td::uint32 retries) {
+  auto idx = choose_client();
+  if (idx < 0) {
+    promise.set_error(td::Status::Error(ErrorCode::notready, "no connections"));
+    return;
+  }
+  auto &client = clients_[idx];
+  client.outstanding++;
+
+  // a query lost with its connection is resent once through another one
+  auto P = td::PromiseCreator::lambda([SelfId = actor_id(this), idx = static_cast<td::uint32>(idx), name,
+                                       data = data.clone(), timeout, retries,
+                                       promise = std::move(promise)](td::Result<td::BufferSlice> R) mutable {
+    td::actor::send_closure(SelfId, &AdnlExtMultiClientImpl::query_finished, idx);
+    if (R.is_error() && R.error().code() == ErrorCode::notready && retries > 0 && !timeout.is_in_past()) {
+      td::actor::send_closure(SelfId, &AdnlExtMultiClientImpl::do_send_query, std::move(name), std::move(data), timeout,
+                              std::move(promise), retries - 1);
+      return;
+    }
+    promise.set_result(std::move(R));
+  });
+  td::actor::send_closure(client.client, &AdnlExtClient::send_query, std::move(name), std::move(data), timeout,
+                          std::move(P));
+}
+
+void AdnlExtMultiClientImpl::query_finished(td::uint32 idx) {
+  auto &client = clients_.at(idx);
+  CHECK(client.outstanding > 0);
+  client.outstanding--;
+}
+
+td::actor::ActorOwn<AdnlExtMultiClient> AdnlExtMultiClient::create(
+    std::vector<std::pair<AdnlNodeIdFull, td::IPAddress>> servers, td::uint32 connections_per_server,
+    std::unique_ptr<AdnlExtClient::Callback> callback) {
+  return td::actor::create_actor<AdnlExtMultiClientImpl>("extmulticlient", std::move(servers), connections_per_server,
+                                                         std::move(callback));
+}
+
+}  // namespace ton
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "adnl-ext-client.h"
+#include "common/errorcode.h"
+
+namespace ton {
+
+class AdnlExtMultiClientImpl : public AdnlExtMultiClient {
+ public:
+  AdnlExtMultiClientImpl(std::vector<std::pair<AdnlNodeIdFull, td::IPAddress>> servers,
+                         td::uint32 connections_per_server, std::unique_ptr<AdnlExtClient::Callback> callback)
+      : servers_(std::move(servers))
+      , connections_per_server_(std::max<td::uint32>(connections_per_server, 1))
+      , callback_(std::move(callback)) {
+  }
+
+  void start_up() override;
+  void check_ready(td::Promise<td::Unit> promise) override;
+  void send_query(std::string name, td::BufferSlice data, td::Timestamp timeout,
+                  td::Promise<td::BufferSlice> promise) override;
+
+  void client_ready(td::uint32 idx, bool value);
+  void query_finished(td::uint32 idx);
+  void do_send_query(std::string name, td::BufferSlice data, td::Timestamp timeout,
+                     td::Promise<td::BufferSlice> promise, td::uint32 retries);
+
+ private:
+  struct Client {
+    td::actor::ActorOwn<AdnlExtClient> client;
+    bool ready = false;
+    td::uint32 outstanding = 0;
+  };
+
+  std::vector<std::pair<AdnlNodeIdFull, td::IPAddress>> servers_;
+  td::uint32 connections_per_server_;
+  std::unique_ptr<AdnlExtClient::Callback> callback_;
+
+  std::vector<Client> clients_;
+  td::uint32 ready_cnt_ = 0;
+  td::uint32 next_idx_ = 0;
+
+  static constexpr td::uint32 max_retries() {
+    return 1;
+  }
+
+  td::int32 choose_client();
+};
+
+}  // namespace ton
@@ -12,6 +12,11 @@ void AdnlQuery::result(td::BufferSlice data) {
   alarm_timestamp() = td::Timestamp::never();
   hangup();
 }
+void AdnlQuery::reject(td::Status error) {
+  promise_.set_error(std::move(error));
+  alarm_timestamp() = td::Timestamp::never();
+  hangup();
+}
 
 AdnlQueryId AdnlQuery::random_query_id() {
   AdnlQueryId q_id;
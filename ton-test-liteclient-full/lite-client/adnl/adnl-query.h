@@ -26,6 +26,7 @@ class AdnlQuery : public td::actor::Actor {
   }
   void alarm() override;
   void result(td::BufferSlice data);
+  void reject(td::Status error);
   void start_up() override {
     alarm_timestamp() = timeout_;
   }
@@ -0,0 +1,104 @@
+#include "block/smc-method.h"
+#include "vm/boc.h"
+#include "td/utils/base64.h"
+#include "td/utils/crypto.h"
+#include "td/utils/misc.h"
+
+namespace block {
+
+td::Result<long long> parse_smc_method_id(td::Slice word) {
+  if (word.empty()) {
+    return td::Status::Error("method id expected");
+  }
+  auto R = td::to_integer_safe<td::int32>(word);
+  if (R.is_ok()) {
+    return R.ok();
+  }
+  return (td::crc16(word) & 0xffff) | 0x10000;
+}
+
+td::Result<vm::StackEntry> parse_smc_method_arg(td::Slice word) {
+  auto error = [&] { return td::Status::Error(PSLICE() << "cannot parse integer argument `" << word << "`"); };
+  td::Slice digits = word;
+  bool negative = !digits.empty() && digits[0] == '-';
+  if (negative) {
+    digits.remove_prefix(1);
+  }
+  td::RefInt256 x{true};
+  bool ok = false;
+  if (digits.size() > 2 && digits[0] == '0' && digits[1] == 'x') {
+    ok = x.unique_write().parse_hex(digits.data() + 2, (int)digits.size() - 2) == (int)digits.size() - 2;
+  } else if (!digits.empty()) {
+    ok = x.unique_write().parse_dec(digits.data(), (int)digits.size()) == (int)digits.size();
+  }
+  if (!ok) {
+    return error();
+  }
+  if (negative) {
+    x.unique_write().negate().normalize();
+  }
+  // -2^256 fits, 2^256 does not
+  if (!x->signed_fits_bits(257)) {
+    return error();
+  }
+  return vm::StackEntry{std::move(x)};
+}
+
+td::Status parse_smc_method_call(td::Slice method, const std::vector<std::string>& words, long long& method_id,
+                                 std::vector<vm::StackEntry>& args) {
+  TRY_RESULT(id, parse_smc_method_id(method));
+  method_id = id;
+  args.clear();
+  for (auto& word : words) {
+    TRY_RESULT(arg, parse_smc_method_arg(word));
+    args.push_back(std::move(arg));
+  }
+  return td::Status::OK();
+}
+
+namespace {
+
+std::string boc_base64(td::Ref<vm::Cell> cell) {
+  auto R = vm::std_boc_serialize(std::move(cell));
+  return R.is_ok() ? td::base64_encode(R.ok().as_slice()) : std::string{};
+}
+
+void store_entry(td::JsonValueScope& jv, const vm::StackEntry& entry) {
+  auto jo = jv.enter_object();
+  switch (entry.type()) {
+    case vm::StackEntry::t_null:
+      jo("type", "null");
+      break;
+    case vm::StackEntry::t_int:
+      jo("type", "int");
+      jo("value", td::dec_string(entry.as_int()));
+      break;
+    case vm::StackEntry::t_cell:
+      jo("type", "cell");
+      jo("value", boc_base64(entry.as_cell()));
+      break;
+    case vm::StackEntry::t_slice:
+      jo("type", "slice");
+      jo("value", boc_base64(vm::CellBuilder{}.append_cellslice(entry.as_slice()).finalize()));
+      break;
+    case vm::StackEntry::t_tuple:
+      jo("type", "tuple");
+      jo("value", SmcStackJson(*entry.as_tuple()));
+      break;
+    default:
+      jo("type", "other");
+      jo("value", entry.to_string());
+  }
+}
+
+}  // namespace
+
+void SmcStackJson::store(td::JsonValueScope* scope) const {
+  auto ja = scope->enter_array();
+  for (auto& entry : entries_) {
+    auto jv = ja.enter_value();
+    store_entry(jv, entry);
+  }
+}
+
+}  // namespace block
@@ -0,0 +1,31 @@
+#pragma once
+#include "vm/stack.hpp"
+#include "td/utils/JsonBuilder.h"
+#include "td/utils/Status.h"
+#include <string>
+#include <vector>
+
+namespace block {
+
+// Get-methods of smart contracts run outside of a transaction, e.g. by the runmethod query of the lite-client.
+
+// a method id is a number or the name of a get-method, named methods having id (crc16(name) & 0xffff) | 0x10000
+td::Result<long long> parse_smc_method_id(td::Slice word);
+// an integer argument fitting into 257 bits, in decimal or in hex with 0x, possibly with a minus
+td::Result<vm::StackEntry> parse_smc_method_arg(td::Slice word);
+td::Status parse_smc_method_call(td::Slice method, const std::vector<std::string>& words, long long& method_id,
+                                 std::vector<vm::StackEntry>& args);
+
+// Stack entries as a JSON array, in the order of the tuple or from the bottom of the stack.
+// Integers are strings, since they may not fit into a JSON number; cells and slices are base64 bags of cells.
+class SmcStackJson : public td::Jsonable {
+ public:
+  explicit SmcStackJson(const std::vector<vm::StackEntry>& entries) : entries_(entries) {
+  }
+  void store(td::JsonValueScope* scope) const;
+
+ private:
+  const std::vector<vm::StackEntry>& entries_;
+};
+
+}  // namespace block
@@ -14,10 +14,15 @@
 #include "common/util.h"
 #include "vm/cells.h"
 #include "vm/cellslice.h"
+#include "vm/dict.h"
+#include "tl/tlblib.hpp"
 
 #include "td/utils/tests.h"
 #include "td/utils/crypto.h"
+#include "td/utils/format.h"
 #include "td/utils/misc.h"
+#include "td/utils/Random.h"
+#include "td/utils/Timer.h"
 
 std::stringstream create_ss() {
   std::stringstream ss;
@@ -500,3 +505,183 @@ TEST(base64, main) {
   os << std::dec << std::endl;
   REGRESSION_VERIFY(os.str());
 }
+
+// the extra of a subtree is the number of its leaves
+struct LeafCount final : vm::dict::AugmentationData {
+  bool skip_extra(vm::CellSlice& cs) const override {
+    return cs.advance(32);
+  }
+  bool eval_leaf(vm::CellBuilder& cb, vm::CellSlice& val_cs) const override {
+    return cb.store_long_bool(1, 32);
+  }
+  bool eval_fork(vm::CellBuilder& cb, vm::CellSlice& left_cs, vm::CellSlice& right_cs) const override {
+    return cb.store_long_bool(left_cs.prefetch_ulong(32) + right_cs.prefetch_ulong(32), 32);
+  }
+  bool eval_empty(vm::CellBuilder& cb) const override {
+    return cb.store_long_bool(0, 32);
+  }
+};
+
+TEST(Dictionary, lookup_many) {
+  td::Random::Xorshift128plus rnd{123};
+  LeafCount aug;
+  for (int key_bits : {1, 8, 64, 256}) {
+    for (int size : {0, 1, 10, 1000}) {
+      vm::Dictionary dict{key_bits};
+      vm::AugmentedDictionary aug_dict{key_bits, aug};
+      std::vector<td::BitArray<256>> stored;
+      for (int i = 0; i < size; i++) {
+        td::BitArray<256> key;
+        td::Random::secure_bytes(key.as_slice());
+        // short random keys collide, so some values are replaced
+        vm::CellBuilder cb;
+        cb.store_long(i, 32);
+        dict.set_builder(key.cbits(), key_bits, cb);
+        aug_dict.set_builder(key.cbits(), key_bits, cb);
+        stored.push_back(key);
+      }
+      // present, absent and repeated keys, in random order and sorted
+      std::vector<td::BitArray<256>> keys;
+      for (int i = 0; i < 2 * size + 10; i++) {
+        if (!stored.empty() && rnd.fast(0, 1)) {
+          keys.push_back(stored[rnd.fast(0, static_cast<int>(stored.size()) - 1)]);
+        } else {
+          td::BitArray<256> key;
+          td::Random::secure_bytes(key.as_slice());
+          keys.push_back(key);
+        }
+      }
+      for (bool sorted : {false, true}) {
+        if (sorted) {
+          std::sort(keys.begin(), keys.end(), [&](const auto& a, const auto& b) {
+            return td::bitstring::bits_memcmp(a.cbits(), b.cbits(), key_bits) < 0;
+          });
+        }
+        std::vector<td::ConstBitPtr> key_ptrs;
+        for (auto& key : keys) {
+          key_ptrs.push_back(key.cbits());
+        }
+        auto values = dict.lookup_many(key_ptrs, key_bits);
+        auto aug_values = aug_dict.lookup_many(key_ptrs, key_bits);
+        ASSERT_EQ(keys.size(), values.size());
+        ASSERT_EQ(keys.size(), aug_values.size());
+        for (std::size_t i = 0; i < keys.size(); i++) {
+          for (auto& pair : {std::make_pair(dict.lookup(keys[i].cbits(), key_bits), values[i]),
+                             std::make_pair(aug_dict.lookup(keys[i].cbits(), key_bits), aug_values[i])}) {
+            ASSERT_EQ(pair.first.is_null(), pair.second.is_null());
+            if (pair.first.not_null()) {
+              ASSERT_EQ(pair.first->prefetch_ulong(32), pair.second->prefetch_ulong(32));
+              ASSERT_EQ(pair.first->size(), pair.second->size());
+            }
+          }
+        }
+      }
+      if (key_bits == 256) {
+        auto values = dict.lookup_many(keys);
+        for (std::size_t i = 0; i < keys.size(); i++) {
+          ASSERT_EQ(dict.lookup(keys[i]).is_null(), values[i].is_null());
+        }
+      }
+    }
+  }
+}
+
+TEST(Dictionary, lookup_many_benchmark) {
+  // accounts keyed by random 256-bit addresses; smoke-sized for the unit tests,
+  // set size to 1 << 20 for a dictionary as large as a real ShardAccounts
+  const int size = 1 << 15;
+  LeafCount aug;
+  vm::AugmentedDictionary dict{256, aug};
+  std::vector<td::Bits256> stored;
+  for (int i = 0; i < size; i++) {
+    td::Bits256 key;
+    td::Random::secure_bytes(key.as_slice());
+    vm::CellBuilder cb;
+    cb.store_long(i, 64);
+    dict.set_builder(key.cbits(), 256, cb);
+    stored.push_back(key);
+  }
+  td::Random::Xorshift128plus rnd{123};
+  for (int n : {100, 10000}) {
+    std::vector<td::Bits256> keys;
+    for (int i = 0; i < n; i++) {
+      keys.push_back(stored[rnd.fast(0, size - 1)]);
+    }
+    std::sort(keys.begin(), keys.end());
+    td::Timer timer;
+    for (auto& key : keys) {
+      CHECK(dict.lookup(key).not_null());
+    }
+    auto one_by_one = timer.elapsed();
+    timer = td::Timer();
+    for (auto& value : dict.lookup_many(keys)) {
+      CHECK(value.not_null());
+    }
+    auto batched = timer.elapsed();
+    LOG(ERROR) << "Bench [AugmentedDictionary lookup of " << n << " keys of " << size << "]: one by one "
+               << td::format::as_time(one_by_one) << ", lookup_many " << td::format::as_time(batched);
+  }
+}
+
+// note$_ len:(## 8) text:(len * [ uint8 ]) value:uint256 next:(Maybe ^Note) = Note;
+struct TestNote final : tlb::TLB {
+  bool skip(vm::CellSlice& cs) const override {
+    int len;
+    return cs.fetch_uint_to(8, len) && cs.advance(len * 8 + 256) && (cs.fetch_ulong(1) ? cs.advance_refs(1) : true);
+  }
+  bool print_skip(tlb::PrettyPrinter& pp, vm::CellSlice& cs) const override {
+    int len;
+    if (!(cs.fetch_uint_to(8, len) && cs.have(len * 8 + 256))) {
+      return pp.fail("truncated note");
+    }
+    std::string text(len, 0);
+    cs.fetch_bytes(reinterpret_cast<unsigned char*>(&text[0]), len);
+    if (!(pp.open("note") && pp.field("text") && pp.out(text) && pp.fetch_uint256_field(cs, 256, "value") &&
+          pp.field("next"))) {
+      return false;
+    }
+    if (cs.fetch_ulong(1)) {
+      if (!print_ref(pp, cs.fetch_ref())) {
+        return false;
+      }
+    } else if (!pp.out_null()) {
+      return false;
+    }
+    return pp.close();
+  }
+};
+
+TEST(TLB, print_json) {
+  TestNote t_Note;
+  auto make_note = [](std::string text, long long value, td::Ref<vm::Cell> next) {
+    vm::CellBuilder cb;
+    cb.store_long(text.size(), 8).store_bytes(text).store_zeroes(192).store_long(value, 64);
+    cb.store_long(next.not_null(), 1);
+    if (next.not_null()) {
+      cb.store_ref(std::move(next));
+    }
+    return cb.finalize();
+  };
+  auto inner = make_note("tab\there", 7, {});
+  auto outer = make_note("say \"hi\"\\\n", 1000000239, inner);
+
+  std::ostringstream os;
+  ASSERT_TRUE(t_Note.print_ref_json(os, outer));
+  ASSERT_EQ(
+      "{\"@type\":\"note\",\"text\":\"say \\\"hi\\\"\\\\\\u000a\",\"value\":\"1000000239\","
+      "\"next\":{\"@type\":\"note\",\"text\":\"tab\\u0009here\",\"value\":\"7\",\"next\":null}}",
+      os.str());
+
+  std::ostringstream os2;
+  ASSERT_TRUE(t_Note.print_json(os2, vm::load_cell_slice(inner)));
+  ASSERT_EQ("{\"@type\":\"note\",\"text\":\"tab\\u0009here\",\"value\":\"7\",\"next\":null}", os2.str());
+
+  // a failure deep inside still yields one valid object carrying the error
+  vm::CellBuilder cb;
+  cb.store_long(2, 8).store_bytes("ok").store_zeroes(256).store_long(1, 1).store_ref(
+      vm::CellBuilder().store_long(5, 8).finalize());
+  std::ostringstream os3;
+  ASSERT_TRUE(!t_Note.print_ref_json(os3, cb.finalize()));
+  ASSERT_EQ(
+      "{\"@type\":\"note\",\"text\":\"ok\",\"value\":\"0\",\"next\":null,\"@error\":\"truncated note\"}", os3.str());
+}
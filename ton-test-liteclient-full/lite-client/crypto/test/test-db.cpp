@@ -1,9 +1,11 @@
 #include "vm/boc.h"
 #include "vm/cellslice.h"
 #include "vm/cells.h"
+#include "vm/dict.h"
 #include "common/AtomicRef.h"
 #include "vm/cells/MerkleProof.h"
 #include "vm/cells/MerkleUpdate.h"
+#include "vm/cells/CellAllocator.h"
 #include "vm/db/BlobView.h"
 #include "vm/db/CellStorage.h"
 #include "vm/db/CellHashTable.h"
@@ -18,7 +20,9 @@
 #include "td/utils/Status.h"
 #include "td/utils/Timer.h"
 #include "td/utils/filesystem.h"
+#include "td/utils/PathView.h"
 #include "td/utils/port/path.h"
+#include "td/utils/port/Stat.h"
 #include "td/utils/format.h"
 #include "td/utils/misc.h"
 #include "td/utils/tests.h"
@@ -29,6 +33,7 @@
 #include "td/db/MemoryKeyValue.h"
 
 #include <set>
+#include <thread>
 #include <map>
 
 #include <openssl/sha.h>
@@ -428,6 +433,21 @@ std::vector<Ref<Cell>> gen_random_cells(int roots, int size, td::Random::Xorshif
   return RandomBagOfCells(size, rnd, with_prunned_branches, std::move(cells)).get_random_roots(roots, rnd);
 }
 
+// a complete binary tree of 2^depth - 1 distinct cells, each holding its own number
+Ref<Cell> gen_binary_tree(int depth) {
+  td::uint64 counter = 0;
+  std::function<Ref<Cell>(int)> gen = [&](int d) {
+    CellBuilder cb;
+    cb.store_long(counter++, 64);
+    if (d > 1) {
+      cb.store_ref(gen(d - 1));
+      cb.store_ref(gen(d - 1));
+    }
+    return cb.finalize();
+  };
+  return gen(depth);
+}
+
 TEST(Cell, MerkleProof) {
   td::Random::Xorshift128plus rnd{123};
   for (int t = 0; t < 1000; t++) {
@@ -741,6 +761,81 @@ TEST(TonDb, DynamicBoc) {
   ASSERT_EQ(0u, kv->count("").ok());
 };
 
+TEST(TonDb, BenchDynamicBocCommit) {
+  // every commit replaces random leaves of a binary tree with 2^18 leaves, i.e. about 18 cells per changed leaf
+  const int depth = 18;
+  td::Random::Xorshift128plus rnd{123};
+  auto leaf = [](td::uint64 index, td::uint64 value) {
+    CellBuilder cb;
+    cb.store_long(index, 32).store_long(value, 64);
+    return cb.finalize();
+  };
+  std::function<Ref<Cell>(int, td::uint64)> gen = [&](int d, td::uint64 index) {
+    if (d == 0) {
+      return leaf(index, 0);
+    }
+    CellBuilder cb;
+    cb.store_ref(gen(d - 1, index * 2)).store_ref(gen(d - 1, index * 2 + 1));
+    return cb.finalize();
+  };
+  td::uint64 new_cells = 0;
+  std::function<Ref<Cell>(Ref<Cell>, int, td::uint64, td::uint64)> update = [&](Ref<Cell> cell, int d,
+                                                                                 td::uint64 index, td::uint64 value) {
+    new_cells++;
+    if (d == 0) {
+      return leaf(index, value);
+    }
+    CellSlice cs(NoVm(), std::move(cell));
+    auto left = cs.prefetch_ref(0);
+    auto right = cs.prefetch_ref(1);
+    if ((index >> (d - 1)) & 1) {
+      right = update(std::move(right), d - 1, index, value);
+    } else {
+      left = update(std::move(left), d - 1, index, value);
+    }
+    CellBuilder cb;
+    cb.store_ref(std::move(left)).store_ref(std::move(right));
+    return cb.finalize();
+  };
+
+  auto kv = std::make_shared<td::MemoryKeyValue>();
+  auto dboc = DynamicBagOfCellsDb::create();
+  auto commit = [&] {
+    dboc->prepare_commit();
+    CellStorer cell_storer(*kv);
+    dboc->commit(cell_storer);
+  };
+  dboc->set_loader(std::make_unique<CellLoader>(kv));
+  auto root = gen(depth, 0);
+  auto root_hash = root->get_hash().as_slice().str();
+  dboc->inc(root);
+  commit();
+  root = {};
+
+  for (int changes : {1000, 10000, 100000}) {
+    const int commits = 5;
+    double elapsed = 0;
+    new_cells = 0;
+    for (int t = 0; t < commits; t++) {
+      dboc->set_loader(std::make_unique<CellLoader>(kv));
+      auto old_root = dboc->load_cell(root_hash).move_as_ok();
+      auto new_root = Ref<Cell>(old_root);
+      for (int i = 0; i < changes; i++) {
+        new_root = update(std::move(new_root), depth, rnd() & ((1 << depth) - 1), rnd());
+      }
+      td::Timer timer;
+      dboc->inc(new_root);
+      dboc->dec(old_root);
+      commit();
+      elapsed += timer.elapsed();
+      root_hash = new_root->get_hash().as_slice().str();
+    }
+    LOG(ERROR) << "Bench [DynamicBagOfCellsDb commit of " << changes << " changed leaves]: "
+               << td::format::as_time(elapsed / commits) << " per commit, "
+               << static_cast<td::uint64>(static_cast<double>(new_cells) / elapsed) << " new cells/s";
+  }
+}
+
 template <class BocDeserializerT>
 td::Status test_boc_deserializer(std::vector<Ref<Cell>> cells, int mode) {
   auto total_data_cells_before = vm::DataCell::get_total_data_cells();
@@ -844,6 +939,362 @@ TEST(TonDb, BocDeserializerSimpleThreads) {
   test_boc_deserializer_threads<StaticBagOfCellsDbLazy>();
 }
 
+// one cell per cache shard, so almost every load evicts another cell
+struct StaticBagOfCellsDbLazyTinyCache {
+  static td::Result<std::shared_ptr<StaticBagOfCellsDb>> create(std::string data) {
+    StaticBagOfCellsDbLazy::Options options;
+    options.cache_capacity = 1;
+    return StaticBagOfCellsDbLazy::create(std::move(data), options);
+  }
+};
+
+TEST(TonDb, BocDeserializerTinyCache) {
+  test_boc_deserializer<StaticBagOfCellsDbLazyTinyCache>();
+}
+
+TEST(TonDb, BocDeserializerTinyCacheThreads) {
+  test_boc_deserializer_threads<StaticBagOfCellsDbLazyTinyCache>();
+}
+
+TEST(TonDb, BocCorruptedCellHeader) {
+  // a cell rejected after it was created must not be left to the hash batch, see DataCell::HashBatch
+  auto root = gen_binary_tree(8);
+  auto serialized = serialize_boc(root, 0);
+  BagOfCells::Info info;
+  ASSERT_TRUE(info.parse_serialized_header(serialized) > 0);
+  // the last cell is a leaf: d1, d2 and 8 bytes of data
+  auto leaf_offset = info.data_offset + info.data_size - 10;
+  ASSERT_EQ(0, serialized[leaf_offset]);
+  for (int d1 : {32 /* level mask 1 */, 8 /* special */}) {
+    auto corrupted = serialized;
+    corrupted[leaf_offset] = static_cast<char>(d1);
+    for (int threads_n : {1, 2}) {
+      ASSERT_TRUE(BagOfCells().deserialize(corrupted, threads_n).is_error());
+      BagOfCells boc;
+      boc.deserialize(serialized, threads_n).ensure();
+      ASSERT_EQ(root->get_hash(), boc.get_root_cell()->get_hash());
+    }
+  }
+}
+
+TEST(TonDb, BocCrc32c) {
+  // large enough to be checksummed in several parts
+  const int depth = 19;
+  auto root = gen_binary_tree(depth);
+  auto serialized = serialize_boc(root, BagOfCells::WithIndex | BagOfCells::WithCRC32C);
+  auto corrupted = serialized;
+  corrupted[corrupted.size() / 2] ^= 1;
+  for (int threads_n : {1, 3}) {
+    BagOfCells boc;
+    boc.deserialize(serialized, threads_n).ensure();
+    ASSERT_EQ(root->get_hash(), boc.get_root_cell()->get_hash());
+    ASSERT_TRUE(BagOfCells().deserialize(corrupted, threads_n).is_error());
+
+    StaticBagOfCellsDbLazy::Options options;
+    options.check_crc32c = true;
+    options.check_crc32c_threads = threads_n;
+    auto lazy = StaticBagOfCellsDbLazy::create(td::BufferSlice(serialized), options).move_as_ok();
+    ASSERT_EQ(root->get_hash(), lazy->get_root_cell(0).move_as_ok()->get_hash());
+    auto lazy_corrupted = StaticBagOfCellsDbLazy::create(td::BufferSlice(corrupted), options).move_as_ok();
+    ASSERT_TRUE(lazy_corrupted->get_root_count().is_error());
+  }
+}
+
+TEST(TonDb, BocIndexSidecar) {
+  td::Random::Xorshift128plus rnd{123};
+  auto dir = td::mkdtemp(td::realpath(".").move_as_ok(), "boc").move_as_ok();
+  auto index_path = dir + TD_DIR_SLASH + "boc.idx";
+  for (int t = 0; t < 20; t++) {
+    auto cell = gen_random_cell(rnd.fast(1, 1000), rnd);
+    for (auto mode : get_serialization_modes()) {
+      if (mode & BagOfCells::WithIndex) {
+        continue;
+      }
+      auto serialized = serialize_boc(cell, mode);
+      td::unlink(index_path).ignore();
+      // built, reused, rebuilt for another key
+      for (auto key : {"a", "a", "b"}) {
+        StaticBagOfCellsDbLazy::Options options;
+        options.index_path = index_path;
+        options.index_key = key;
+        auto boc = StaticBagOfCellsDbLazy::create(td::BufferSlice(serialized), options).move_as_ok();
+        auto root = boc->get_root_cell(0).move_as_ok();
+        ASSERT_EQ(cell->get_hash(), root->get_hash());
+        ASSERT_EQ(serialized, serialize_boc(root, mode));
+        ASSERT_TRUE(td::stat(index_path).is_ok());
+      }
+      // a damaged entry is noticed and the index is rebuilt
+      auto index = td::read_file_str(index_path).move_as_ok();
+      auto damaged = index;
+      damaged[damaged.size() - 5] ^= 1;
+      td::write_file(index_path, damaged).ensure();
+      StaticBagOfCellsDbLazy::Options options;
+      options.index_path = index_path;
+      options.index_key = "b";
+      auto boc = StaticBagOfCellsDbLazy::create(td::BufferSlice(serialized), options).move_as_ok();
+      ASSERT_EQ(serialized, serialize_boc(boc->get_root_cell(0).move_as_ok(), mode));
+      ASSERT_EQ(index, td::read_file_str(index_path).move_as_ok());
+    }
+  }
+  td::unlink(index_path).ignore();
+  td::rmdir(dir).ignore();
+}
+
+TEST(TonDb, BocLazyFile) {
+  // a dictionary mapped from a file and loaded lazily, as the lite client loads a downloaded state
+  td::Random::Xorshift128plus rnd{123};
+  auto dir = td::mkdtemp(td::realpath(".").move_as_ok(), "boc").move_as_ok();
+  auto path = dir + TD_DIR_SLASH + "boc";
+  auto index_path = path + ".idx";
+  Dictionary dict{256};
+  std::vector<td::Bits256> keys;
+  for (int i = 0; i < 1000; i++) {
+    td::Bits256 key;
+    td::sha256(PSLICE() << i, key.as_slice());
+    dict.set_builder(key.cbits(), 256, CellBuilder().store_long(i, 32));
+    keys.push_back(key);
+  }
+  auto root = dict.get_root_cell();
+  for (auto mode : get_serialization_modes()) {
+    td::write_file(path, serialize_boc(root, mode)).ensure();
+    auto std_root = std_boc_deserialize(td::read_file(path).move_as_ok()).move_as_ok();
+    for (bool with_sidecar : {false, true}) {
+      StaticBagOfCellsDbLazy::Options options;
+      if (with_sidecar) {
+        options.index_path = index_path;
+        options.index_key = "key";
+      }
+      auto boc = StaticBagOfCellsDbLazy::create(vm::FileMemoryMappingBlobView::create(path).move_as_ok(), options)
+                     .move_as_ok();
+      ASSERT_EQ(1u, boc->get_root_count().move_as_ok());
+      auto lazy_root = boc->get_root_cell(0).move_as_ok();
+      ASSERT_EQ(std_root->get_hash(), lazy_root->get_hash());
+      Dictionary std_dict{std_root, 256};
+      Dictionary lazy_dict{lazy_root, 256};
+      for (int i = 0; i < 100; i++) {
+        auto& key = keys[rnd.fast(0, (int)keys.size() - 1)];
+        auto value = lazy_dict.lookup(key.cbits(), 256);
+        ASSERT_TRUE(value.not_null());
+        ASSERT_EQ(std_dict.lookup(key.cbits(), 256)->prefetch_ulong(32), value->prefetch_ulong(32));
+      }
+      td::Bits256 missing;
+      td::sha256("missing", missing.as_slice());
+      ASSERT_TRUE(lazy_dict.lookup(missing.cbits(), 256).is_null());
+    }
+    td::unlink(index_path).ignore();
+  }
+  td::unlink(path).ignore();
+  td::rmdir(dir).ignore();
+}
+
+TEST(TonDb, BenchBocIndexSidecar) {
+  // opening a 2^21-cell bag of cells without an index and reading one of its last cells
+  const int depth = 21;
+  const int cells = (1 << depth) - 1;
+  auto dir = td::mkdtemp(td::realpath(".").move_as_ok(), "boc").move_as_ok();
+  auto path = dir + TD_DIR_SLASH + "boc";
+  auto index_path = path + ".idx";
+  td::write_file(path, serialize_boc(gen_binary_tree(depth), BagOfCells::WithIntHashes | BagOfCells::WithTopHash)).ensure();
+
+  auto open = [&](td::Slice name, bool with_sidecar) {
+    StaticBagOfCellsDbLazy::Options options;
+    if (with_sidecar) {
+      options.index_path = index_path;
+      options.index_key = "key";
+    }
+    td::Timer timer;
+    auto boc = StaticBagOfCellsDbLazy::create(vm::FileMemoryMappingBlobView::create(path).move_as_ok(), options)
+                   .move_as_ok();
+    auto cell = boc->get_root_cell(0).move_as_ok();
+    while (cell->get_depth() > 0) {
+      cell = CellSlice(NoVm(), std::move(cell)).prefetch_ref(1);
+    }
+    LOG(ERROR) << "Bench [BagOfCells open of " << cells << " cells without index, " << name
+               << "]: " << td::format::as_time(timer.elapsed());
+  };
+  open("no sidecar", false);
+  open("building sidecar", true);
+  open("with sidecar", true);
+  td::unlink(index_path).ignore();
+  td::unlink(path).ignore();
+  td::rmdir(dir).ignore();
+}
+
+TEST(TonDb, BocDeserializerParallel) {
+  td::Random::Xorshift128plus rnd{123};
+  for (int t = 0; t < 20; t++) {
+    auto cells = gen_random_cells(rnd.fast(1, 10), static_cast<int>(rnd() % 10000 + 1), rnd);
+    for (auto mode : get_serialization_modes()) {
+      auto serialized = serialize_boc(cells, mode);
+      for (int threads_n : {2, 4}) {
+        BagOfCells boc;
+        boc.deserialize(serialized, threads_n).ensure();
+        ASSERT_EQ(static_cast<int>(cells.size()), boc.get_root_count());
+        for (size_t i = 0; i < cells.size(); i++) {
+          ASSERT_EQ(cells[i]->get_hash(), boc.get_root_cell(static_cast<int>(i))->get_hash());
+        }
+      }
+    }
+  }
+  // a damaged bag of cells is rejected with the same error as without threads
+  auto describe = [](td::Result<long long> r) { return r.is_ok() ? std::string("ok") : r.error().to_string(); };
+  for (int t = 0; t < 200; t++) {
+    auto cells = gen_random_cells(rnd.fast(1, 10), static_cast<int>(rnd() % 1000 + 1), rnd);
+    auto serialized = serialize_boc(cells, 0);
+    BagOfCells::Info info;
+    ASSERT_TRUE(info.parse_serialized_header(serialized) > 0);
+    for (int k = rnd.fast(1, 3); k > 0; k--) {
+      serialized[info.data_offset + rnd() % info.data_size] ^= static_cast<char>(1 << rnd.fast(0, 7));
+    }
+    auto expected = describe(BagOfCells().deserialize(serialized, 1));
+    for (int threads_n : {2, 4}) {
+      ASSERT_EQ(expected, describe(BagOfCells().deserialize(serialized, threads_n)));
+    }
+  }
+}
+
+TEST(TonDb, BenchBocDeserializerParallel) {
+  // a complete binary tree of 2^18 distinct cells, about the width of a shard state
+  const int depth = 18;
+  const int cells = (1 << depth) - 1;
+  auto root = gen_binary_tree(depth);
+  auto serialized = serialize_boc(root, BagOfCells::WithIndex);
+  for (int threads_n : {1, 2, 4, 8}) {
+    double best = 0;
+    for (int t = 0; t < 3; t++) {
+      td::Timer timer;
+      BagOfCells boc;
+      boc.deserialize(serialized, threads_n).ensure();
+      best = t == 0 ? timer.elapsed() : std::min(best, timer.elapsed());
+      ASSERT_EQ(root->get_hash(), boc.get_root_cell()->get_hash());
+    }
+    LOG(ERROR) << "Bench [BagOfCells::deserialize " << cells << " cells " << threads_n
+               << " threads]: " << td::StringBuilder::FixedDouble(static_cast<double>(cells) / best, 3)
+               << " cells/sec";
+  }
+}
+
+TEST(Cell, CellAllocatorThreads) {
+  // cells created by one thread and freed by another must be reused instead of piling up in the second thread
+  const int n = 100000;
+  std::vector<Ref<Cell>> cells;
+  auto created = [&](int round) {
+    td::thread([&] {
+      for (int i = 0; i < n; i++) {
+        CellBuilder cb;
+        cb.store_long(round, 32).store_long(i, 32);
+        cells.push_back(cb.finalize());
+      }
+    }).join();
+    for (int i = 0; i < n; i++) {
+      CellBuilder cb;
+      cb.store_long(round, 32).store_long(i, 32);
+      ASSERT_EQ(cb.finalize()->get_hash(), cells[i]->get_hash());
+    }
+    td::thread([&] { cells.clear(); }).join();
+    return vm::detail::CellAllocator::get_stats().slabs;
+  };
+  auto slabs = created(0);
+  for (int round = 1; round < 20; round++) {
+    created(round);
+  }
+  ASSERT_TRUE(vm::detail::CellAllocator::get_stats().slabs <= slabs * 2);
+}
+
+TEST(Cell, CellAllocatorStdThreads) {
+  // threads not created by td return their free lists when they exit, so short-lived threads reuse the same slabs
+  auto round = [] {
+    std::thread([] {
+      std::vector<Ref<Cell>> cells;
+      for (int i = 0; i < 10000; i++) {
+        CellBuilder cb;
+        cb.store_long(i, 32);
+        cells.push_back(cb.finalize());
+      }
+    }).join();
+    return vm::detail::CellAllocator::get_stats().slabs;
+  };
+  auto slabs = round();
+  for (int i = 0; i < 50; i++) {
+    round();
+  }
+  ASSERT_TRUE(vm::detail::CellAllocator::get_stats().slabs <= slabs * 2);
+}
+
+TEST(TonDb, BenchBocDeserializerCellAllocation) {
+  // memory for the cells of a deserialized bag is taken from the cell pool, not allocated cell by cell
+  const int depth = 21;
+  const int cells = (1 << depth) - 1;
+  auto serialized = serialize_boc(gen_binary_tree(depth), BagOfCells::WithIndex);
+  for (int t = 0; t < 3; t++) {
+    auto slabs = vm::detail::CellAllocator::get_stats().slabs;
+    td::Timer timer;
+    double deserialize_time;
+    {
+      BagOfCells boc;
+      boc.deserialize(serialized).ensure();
+      deserialize_time = timer.elapsed();
+      slabs = vm::detail::CellAllocator::get_stats().slabs - slabs;
+    }
+    LOG(ERROR) << "Bench [BagOfCells::deserialize " << cells << " cells]: "
+               << td::StringBuilder::FixedDouble(static_cast<double>(cells) / deserialize_time, 3)
+               << " cells/sec, " << slabs << " new slabs, freed in " << td::format::as_time(timer.elapsed() - deserialize_time);
+  }
+}
+
+TEST(TonDb, BocStreamingSerializer) {
+  td::Random::Xorshift128plus rnd{123};
+  for (int t = 0; t < 20; t++) {
+    auto cells = gen_random_cells(rnd.fast(1, 10), static_cast<int>(rnd() % 10000 + 1), rnd);
+    vm::BagOfCells boc;
+    for (auto &cell : cells) {
+      boc.add_root(cell);
+    }
+    boc.import_cells().ensure();
+    for (auto mode : get_serialization_modes()) {
+      auto serialized = boc.serialize_to_string(mode);
+      for (std::size_t buffer_size : {1, 1000, 1 << 20}) {
+        td::ChainBufferWriter writer;
+        boc.serialize_to_buffer(writer, mode, buffer_size).ensure();
+        ASSERT_EQ(serialized, writer.extract_reader().move_as_buffer_slice().as_slice().str());
+      }
+    }
+  }
+}
+
+TEST(TonDb, BenchBocStreamingSerializer) {
+  // peak RSS while writing an imported bag of 2^21 cells to a file: all at once and streamed
+  const int depth = 21;
+  const int cells = (1 << depth) - 1;
+  vm::BagOfCells boc;
+  boc.add_root(gen_binary_tree(depth));
+  boc.import_cells().ensure();
+  auto mode = BagOfCells::WithIndex | BagOfCells::WithCRC32C;
+  auto path = td::mkdtemp(td::realpath(".").move_as_ok(), "boc").move_as_ok() + TD_DIR_SLASH + "boc";
+  auto rss_growth = [](auto &&f) {
+    // "5" resets the peak RSS (VmHWM) of the process
+    td::write_file("/proc/self/clear_refs", "5").ignore();
+    auto before = td::mem_stat().move_as_ok().resident_size_;
+    td::Timer timer;
+    f();
+    return std::make_pair(td::mem_stat().move_as_ok().resident_size_peak_ - before, timer.elapsed());
+  };
+  auto in_memory = rss_growth([&] { td::write_file(path, boc.serialize_to_slice(mode).move_as_ok()).ensure(); });
+  auto size = td::stat(path).move_as_ok().size_;
+  auto streamed = rss_growth([&] {
+    auto fd = td::FileFd::open(path, td::FileFd::Write | td::FileFd::Truncate).move_as_ok();
+    boc.serialize_to_file(fd, mode).ensure();
+    fd.close();
+  });
+  ASSERT_EQ(size, td::stat(path).move_as_ok().size_);
+  for (auto &res : {std::make_pair("in memory", in_memory), std::make_pair("streamed", streamed)}) {
+    LOG(ERROR) << "Bench [BagOfCells serialization of " << cells << " cells (" << (size >> 20) << "MB) "
+               << res.first << "]: peak RSS +" << (res.second.first >> 20) << "MB, " << res.second.second << "s";
+  }
+  td::unlink(path).ignore();
+  td::rmdir(td::PathView(path).parent_dir().str()).ignore();
+}
+
 class CompactArray {
  public:
   CompactArray(size_t size) {
@@ -1466,7 +1917,7 @@ void bench_deserializer(std::string name, bool full) {
 template <class DeserializerT>
 void bench_deserializer_threads(std::string name) {
   using Config = BenchBocDeserializerConfig;
-  for (auto threads_n : {1, 4, 16}) {
+  for (auto threads_n : {1, 2, 4, 8, 16}) {
     //for (auto threads_n : {16}) {
     //for (auto with_index : {false, true}) {
     //for (auto mode : {BenchBocDeserializerConfig::Prefix, BenchBocDeserializerConfig::Range,
@@ -1,12 +1,18 @@
 #include "vm/continuation.h"
 #include "vm/cp0.h"
 #include "vm/dict.h"
+#include "vm/cells/MerkleProof.h"
+#include "vm/boc.h"
+#include "block/smc-method.h"
 #include "fift/utils.h"
 #include "common/bigint.hpp"
 
 #include "td/utils/tests.h"
 #include "td/utils/ScopeGuard.h"
+#include "td/utils/base64.h"
 #include "td/utils/StringBuilder.h"
+#include "td/utils/Timer.h"
+#include "td/utils/format.h"
 
 std::string run_vm(td::Ref<vm::Cell> cell) {
   vm::init_op_cp0();
@@ -407,3 +413,309 @@ RETALT
 )A";
   test_run_vm(fift::compile_asm(test1).move_as_ok());
 }
+
+TEST(VM, smallint) {
+  // the integers kept inline by the stack must behave exactly as BigInt256 ones
+  vm::init_op_cp0();
+  std::vector<long long> values{0,
+                                1,
+                                -1,
+                                7,
+                                -13,
+                                1LL << 31,
+                                -(1LL << 52),
+                                (1LL << 51) - 1,
+                                1LL << 51,
+                                -(1LL << 51),
+                                -(1LL << 51) - 1,
+                                (1LL << 52) + 5,
+                                1000000000000000000LL,
+                                std::numeric_limits<long long>::max(),
+                                std::numeric_limits<long long>::min(),
+                                std::numeric_limits<long long>::max() - 1,
+                                std::numeric_limits<long long>::min() + 1};
+  std::vector<std::string> ops{"ADD",     "SUB",    "SUBR",    "NEGATE",   "INC",       "DEC",    "MUL",
+                               "QADD",    "QMUL",   "10 MULINT", "-7 ADDINT", "DIV",      "MOD",    "DIVMOD",
+                               "DIVR",    "DIVC",   "LESS",    "EQUAL",    "CMP",       "SGN",    "5 EQINT",
+                               "-1 GTINT", "NEWC 64 STI ENDC CTOS 64 LDI ENDS", "NEWC 63 STU ENDC CTOS 63 PLDU"};
+  for (auto& op : ops) {
+    auto code = vm::load_cell_slice_ref(fift::compile_asm(op).move_as_ok());
+    for (auto x : values) {
+      for (auto y : values) {
+        std::string res[2];
+        for (int big = 0; big < 2; big++) {
+          td::Ref<vm::Stack> stack{true};
+          for (auto v : {x, y}) {
+            if (big) {
+              auto str = std::to_string(v);
+              td::RefInt256 int_ref{true};
+              CHECK(int_ref.unique_write().parse_dec(str.c_str(), (int)str.size()) == (int)str.size());
+              stack.write().push(std::move(int_ref));
+            } else {
+              stack.write().push_smallint(v);
+            }
+          }
+          vm::VmState vm{code, std::move(stack), vm::GasLimits{}, 0 /*flags*/, {} /*data*/, {} /*VmLog*/};
+          int exit_code = vm.run();
+          res[big] = PSTRING() << "exit code " << exit_code << ", gas " << vm.gas_consumed();
+          auto& result = vm.get_stack();
+          for (int j = result.depth(); j > 0; j--) {
+            res[big] += " " + result[j - 1].to_string();
+          }
+        }
+        ASSERT_EQ(res[1], res[0]);
+      }
+    }
+  }
+}
+
+TEST(VM, smallint_store_zero_bits) {
+  // a zero-width signed store holds only 0, inline or not
+  vm::init_op_cp0();
+  for (std::string op : {"NEWC 0 INT STIX ENDC CTOS SBITS", "NEWC 0 INT STIXQ", "NEWC SWAP 0 INT STIXR ENDC CTOS SBITS",
+                       "NEWC 0 INT STUX ENDC CTOS SBITS"}) {
+    auto code = vm::load_cell_slice_ref(fift::compile_asm(op).move_as_ok());
+    for (long long x : {0, 1, -1}) {
+      std::string res[2];
+      int exit_code[2];
+      for (int big = 0; big < 2; big++) {
+        td::Ref<vm::Stack> stack{true};
+        if (big) {
+          stack.write().push(td::RefInt256{true, x});
+        } else {
+          stack.write().push_smallint(x);
+        }
+        vm::VmState vm{code, std::move(stack), vm::GasLimits{}, 0 /*flags*/, {} /*data*/, {} /*VmLog*/};
+        exit_code[big] = ~vm.run();
+        res[big] = PSTRING() << "exit code " << exit_code[big] << ", gas " << vm.gas_consumed();
+        auto& result = vm.get_stack();
+        for (int j = result.depth(); j > 0; j--) {
+          res[big] += " " + result[j - 1].to_string();
+        }
+      }
+      ASSERT_EQ(res[1], res[0]);
+      if (x == 0) {
+        ASSERT_EQ(0, exit_code[0]);
+      } else if (op.find("STIXQ") == std::string::npos) {
+        ASSERT_EQ(static_cast<int>(vm::Excno::range_chk), exit_code[0]);
+      }
+    }
+  }
+}
+
+TEST(VM, run_vm_code_batch) {
+  // a batch on several threads gives the same results as the calls run one by one
+  vm::init_op_cp0();
+  std::vector<td::Ref<vm::CellSlice>> codes;
+  for (auto asm_code : {"DROP c4 PUSH CTOS 32 LDU ENDS ADD", "DROP 100 INT MUL", "DROP 0 INT DIV",
+                        "DROP c4 PUSH CTOS 64 LDU"}) {
+    codes.push_back(vm::load_cell_slice_ref(fift::compile_asm(td::Slice(asm_code)).move_as_ok()));
+  }
+  auto describe = [](const vm::VmBatchCall& call) {
+    std::string res = PSTRING() << "exit code " << call.exit_code << ", gas " << call.gas.gas_consumed() << ", steps "
+                                << call.steps << ", data " << call.data->get_hash().to_hex();
+    for (int i = call.stack->depth(); i > 0; i--) {
+      res += " " + (*call.stack)[i - 1].to_string();
+    }
+    return res;
+  };
+  std::vector<vm::VmBatchCall> calls;
+  std::vector<std::string> expected;
+  for (int i = 0; i < 1000; i++) {
+    vm::VmBatchCall call;
+    call.code = codes[i % codes.size()];
+    call.data = vm::CellBuilder{}.store_long(i, 32).finalize();
+    call.stack = td::Ref<vm::Stack>{true};
+    call.stack.write().push_smallint(i);
+    call.stack.write().push_smallint(85143);  // method id
+    call.gas = vm::GasLimits{i % 7 == 0 ? 30 : 1000};
+    call.flags = 1;
+    calls.push_back(call);
+
+    vm::VmState vm{call.code, td::Ref<vm::Stack>{true, *call.stack}, call.gas, call.flags, call.data, {} /*VmLog*/};
+    call.exit_code = ~vm.run();
+    call.stack = vm.get_stack_ref();
+    if (call.exit_code == 0) {
+      call.data = vm.get_c4();
+    }
+    call.gas = vm.get_gas_limits();
+    call.steps = vm.get_steps_count();
+    expected.push_back(describe(call));
+  }
+  vm::run_vm_code_batch(calls, 4);
+  for (std::size_t i = 0; i < calls.size(); i++) {
+    ASSERT_EQ(expected[i], describe(calls[i]));
+  }
+}
+
+TEST(VM, run_vm_code_batch_pruned_branch) {
+  // loading a pruned branch of a proof ends only the call doing it
+  vm::init_op_cp0();
+  auto code = vm::load_cell_slice_ref(fift::compile_asm("DROP c4 PUSH CTOS LDREF DROP CTOS 32 PLDU").move_as_ok());
+  // a cell without references is never pruned
+  auto child = vm::CellBuilder{}.store_long(7, 32).store_ref(vm::CellBuilder{}.finalize()).finalize();
+  auto data = vm::CellBuilder{}.store_ref(child).finalize();
+  auto proof = vm::MerkleProof::generate(data, [&](const td::Ref<vm::Cell>& cell) {
+    return cell->get_hash() == child->get_hash();
+  });
+  auto pruned_data = vm::MerkleProof::virtualize(proof, 1);
+  ASSERT_EQ(data->get_hash(), pruned_data->get_hash());
+  std::vector<vm::VmBatchCall> calls;
+  for (int i = 0; i < 100; i++) {
+    vm::VmBatchCall call;
+    call.code = code;
+    call.data = i % 3 == 0 ? pruned_data : data;
+    call.stack = td::Ref<vm::Stack>{true};
+    call.stack.write().push_smallint(85143);  // method id
+    call.flags = 1;
+    calls.push_back(call);
+  }
+  vm::run_vm_code_batch(calls, 4);
+  for (int i = 0; i < 100; i++) {
+    if (i % 3 == 0) {
+      ASSERT_EQ(static_cast<int>(vm::Excno::virt_err), calls[i].exit_code);
+    } else {
+      ASSERT_EQ(0, calls[i].exit_code);
+      ASSERT_EQ(1, calls[i].stack->depth());
+      ASSERT_EQ(7, (*calls[i].stack)[0].as_int()->to_long());
+    }
+  }
+}
+
+TEST(VM, smc_method_id) {
+  ASSERT_EQ(85143, block::parse_smc_method_id("seqno").move_as_ok());
+  ASSERT_EQ(78748, block::parse_smc_method_id("get_public_key").move_as_ok());
+  ASSERT_EQ(-3, block::parse_smc_method_id("-3").move_as_ok());
+  ASSERT_EQ(65536 + 3, block::parse_smc_method_id("65539").move_as_ok());
+  ASSERT_TRUE(block::parse_smc_method_id("").is_error());
+}
+
+TEST(VM, smc_method_arg) {
+  auto arg = [](td::Slice word) { return td::dec_string(block::parse_smc_method_arg(word).move_as_ok().as_int()); };
+  ASSERT_EQ("12", arg("12"));
+  ASSERT_EQ("-12", arg("-12"));
+  ASSERT_EQ("-16", arg("-0x10"));
+  ASSERT_EQ("255", arg("0xff"));
+  std::string two_256 = "0x1" + std::string(64, '0');
+  // -2^256 is the least 257-bit integer, 2^256 does not fit
+  ASSERT_EQ("-115792089237316195423570985008687907853269984665640564039457584007913129639936", arg("-" + two_256));
+  ASSERT_EQ("115792089237316195423570985008687907853269984665640564039457584007913129639935",
+            arg("0x" + std::string(64, 'f')));
+  ASSERT_TRUE(block::parse_smc_method_arg(two_256).is_error());
+  ASSERT_TRUE(block::parse_smc_method_arg("-0x1" + std::string(63, '0') + "1").is_error());
+  ASSERT_TRUE(block::parse_smc_method_arg("-").is_error());
+  ASSERT_TRUE(block::parse_smc_method_arg("0x").is_error());
+  ASSERT_TRUE(block::parse_smc_method_arg("12a").is_error());
+
+  long long method_id;
+  std::vector<vm::StackEntry> args;
+  ASSERT_TRUE(block::parse_smc_method_call("seqno", {"1", "-0x2"}, method_id, args).is_ok());
+  ASSERT_EQ(85143, method_id);
+  ASSERT_EQ(2u, args.size());
+  ASSERT_EQ(-2, args[1].as_int()->to_long());
+  ASSERT_TRUE(block::parse_smc_method_call("seqno", {"1", "x"}, method_id, args).is_error());
+}
+
+TEST(VM, smc_stack_json) {
+  td::Ref<vm::Cell> cell = vm::CellBuilder{}.store_long(0xabcd, 16).store_ref(vm::CellBuilder{}.finalize()).finalize();
+  auto boc = td::base64_encode(vm::std_boc_serialize(cell).move_as_ok().as_slice());
+  std::vector<vm::StackEntry> entries;
+  entries.emplace_back(td::RefInt256{true, -5});
+  entries.emplace_back();
+  std::vector<vm::StackEntry> tuple{vm::StackEntry{td::RefInt256{true, 1}}, vm::StackEntry{cell}};
+  entries.emplace_back(td::Ref<vm::Tuple>{true, std::move(tuple)});
+  entries.emplace_back(vm::load_cell_slice_ref(cell));
+  ASSERT_EQ("[{\"type\":\"int\",\"value\":\"-5\"},{\"type\":\"null\"},{\"type\":\"tuple\",\"value\":[{\"type\":"
+            "\"int\",\"value\":\"1\"},{\"type\":\"cell\",\"value\":\"" +
+                boc + "\"}]},{\"type\":\"slice\",\"value\":\"" + boc + "\"}]",
+            td::json_encode<std::string>(block::SmcStackJson(entries)));
+}
+
+void bench_run_vm(td::Slice name, td::Ref<vm::Cell> code, int runs) {
+  vm::init_op_cp0();
+  auto code_cs = vm::load_cell_slice_ref(code);
+  td::StringBuilder sb({}, true);
+  long long total_steps = 0;
+  td::Timer timer;
+  for (int i = 0; i < runs; i++) {
+    vm::Stack stack;
+    long long steps = 0;
+    vm::GasLimits gas;
+    int res = vm::run_vm_code(code_cs, stack, 0 /*flags*/, nullptr /*data*/, {} /*VmLog*/, &steps,
+                              i == 0 ? &gas : nullptr);
+    if (i == 0) {
+      sb << "exit code " << res << ", steps " << steps << ", gas " << gas.gas_consumed() << "\n";
+      for (int j = stack.depth(); j > 0; j--) {
+        sb << stack[j - 1].to_string() << "\n";
+      }
+    }
+    total_steps += steps;
+  }
+  auto elapsed = timer.elapsed();
+  LOG(ERROR) << "Bench [VM " << name << "]: " << static_cast<long long>(static_cast<double>(total_steps) / elapsed)
+             << " steps/sec (" << total_steps << " steps in " << td::format::as_time(elapsed) << ")";
+  REGRESSION_VERIFY(sb.as_cslice());
+}
+
+TEST(VM, bench_arith) {
+  td::Slice code =
+      R"A(
+0 INT
+0 INT
+100000 INT
+REPEAT:<{
+  INC
+  DUP
+  DUP
+  MUL
+  ROT
+  ADD
+  1000000007 INT
+  MOD
+  SWAP
+}>
+DROP
+)A";
+  bench_run_vm("arith", fift::compile_asm(code).move_as_ok(), 10);
+}
+
+TEST(VM, bench_dict) {
+  // fills a dictionary with 1000 values and sums them up looking every key up
+  td::Slice code =
+      R"A(
+NEWDICT
+0 INT
+1000 INT
+REPEAT:<{
+  INC
+  DUP
+  NEWC
+  32 STU
+  OVER
+  s3 PUSH
+  16 INT
+  DICTUSETB
+  s2 POP
+}>
+DROP
+0 INT
+SWAP
+0 INT
+1000 INT
+REPEAT:<{
+  INC
+  DUP
+  s2 PUSH
+  16 INT
+  DICTUGET
+  44 THROWIFNOT
+  32 PLDU
+  s1 s3 XCHG
+  ADD
+  s0 s2 XCHG
+}>
+DROP
+DROP
+)A";
+  bench_run_vm("dict", fift::compile_asm(code).move_as_ok(), 100);
+}
@@ -17,7 +17,7 @@ const RefAnything t_RefCell;
 
 bool Bool::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
   int t = get_tag(cs);
-  return cs.advance(1) && pp.out(t ? "bool_true" : "bool_false");
+  return cs.advance(1) && pp.out_bool(t);
 }
 
 bool NatWidth::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
@@ -36,6 +36,15 @@ bool NatLess::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
 }
 
 bool TupleT::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
+  if (pp.json()) {
+    pp.open("tuple");
+    for (int i = n; i > 0; --i) {
+      if (!(pp.field() && X.print_skip(pp, cs))) {
+        return false;
+      }
+    }
+    return pp.close();
+  }
   pp.open("tuple ");
   pp.os << n << " [";
   pp.mode_nl();
@@ -50,7 +59,7 @@ bool TupleT::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
 }
 
 bool CondT::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
-  return (n > 0 ? X.print_skip(pp, cs) : (!n && pp.out("()")));
+  return (n > 0 ? X.print_skip(pp, cs) : (!n && pp.out_null()));
 }
 
 bool Int::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
@@ -73,6 +82,9 @@ bool UInt::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
 
 bool Bits::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
   if (cs.have(n)) {
+    if (pp.json()) {
+      return pp.out(cs.fetch_bits(n).to_hex());
+    }
     pp.os << 'x' << cs.fetch_bits(n).to_hex();
     return true;
   } else {
@@ -106,7 +118,23 @@ bool TLB::validate_ref_internal(Ref<vm::Cell> cell_ref) const {
   return is_special || (validate_skip(cs) && cs.empty_ext());
 }
 
+// a value without a printer of its own (or a special cell) is shown as raw data
+static bool print_raw_json(PrettyPrinter& pp, const TLB& type, const vm::CellSlice& cs) {
+  std::ostringstream type_os;
+  type_os << type;
+  return pp.open("raw") && pp.field("type") && pp.out(type_os.str()) && pp.field("special") &&
+         pp.out_bool(cs.is_special()) && pp.field("data") && pp.out(cs.as_bitslice().to_hex()) &&
+         pp.field_int(cs.size_refs(), "refs") && pp.close();
+}
+
 bool TLB::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
+  if (pp.json()) {
+    vm::CellSlice cs_copy{cs};
+    if (!validate_skip(cs) || !cs_copy.cut_tail(cs)) {
+      return pp.fail("invalid value");
+    }
+    return print_raw_json(pp, *this, cs_copy);
+  }
   pp.open("raw@");
   pp << *this << ' ';
   vm::CellSlice cs_copy{cs};
@@ -119,6 +147,9 @@ bool TLB::print_skip(PrettyPrinter& pp, vm::CellSlice& cs) const {
 }
 
 bool TLB::print_special(PrettyPrinter& pp, vm::CellSlice& cs) const {
+  if (pp.json()) {
+    return print_raw_json(pp, *this, cs);
+  }
   pp.open("raw@");
   pp << *this << ' ';
   pp.raw_nl();
@@ -154,6 +185,16 @@ bool TLB::print_ref(std::ostream& os, Ref<vm::Cell> cell_ref, int indent) const
   return pp.fail_unless(print_ref(pp, std::move(cell_ref)));
 }
 
+bool TLB::print_json(std::ostream& os, const vm::CellSlice& cs) const {
+  PrettyPrinter pp{os, 0, PrettyPrinter::m_json};
+  return pp.fail_unless(print(pp, cs));
+}
+
+bool TLB::print_ref_json(std::ostream& os, Ref<vm::Cell> cell_ref) const {
+  PrettyPrinter pp{os, 0, PrettyPrinter::m_json};
+  return pp.fail_unless(print_ref(pp, std::move(cell_ref)));
+}
+
 std::string TLB::as_string_skip(vm::CellSlice& cs, int indent) const {
   std::ostringstream os;
   print_skip(os, cs, indent);
@@ -173,6 +214,25 @@ std::string TLB::as_string_ref(Ref<vm::Cell> cell_ref, int indent) const {
 }
 
 PrettyPrinter::~PrettyPrinter() {
+  if (json()) {
+    // close whatever is open, so that the output stays valid JSON and carries the error
+    if (failed || level) {
+      if (json_value_expected) {
+        os << "null";
+      }
+      if (level > 0) {
+        json_field("@error");
+      } else if (json_started) {
+        return;
+      }
+      json_string(json_error.empty() ? "printing failed" : json_error);
+      while (level > 0) {
+        os << '}';
+        --level;
+      }
+    }
+    return;
+  }
   if (failed || level) {
     if (nl_used) {
       nl(-2 * level);
@@ -188,7 +248,44 @@ PrettyPrinter::~PrettyPrinter() {
   }
 }
 
+void PrettyPrinter::json_string(const std::string& str) {
+  static const char hex_digits[] = "0123456789abcdef";
+  os << '"';
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      os << "\\u00" << hex_digits[(c >> 4) & 15] << hex_digits[c & 15];
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+void PrettyPrinter::json_value() {
+  json_value_expected = false;
+  json_started = true;
+}
+
+bool PrettyPrinter::json_field(std::string name) {
+  if (!json_fields.empty() && json_fields.back()++) {
+    os << ',';
+  }
+  json_string(name);
+  os << ':';
+  json_value_expected = true;
+  return true;
+}
+
 bool PrettyPrinter::fail(std::string msg) {
+  if (json()) {
+    if (json_error.empty()) {
+      json_error = std::move(msg);
+    }
+    failed = true;
+    return false;
+  }
   os << "<FATAL: " << msg << ">";
   failed = true;
   return false;
@@ -196,6 +293,9 @@ bool PrettyPrinter::fail(std::string msg) {
 
 bool PrettyPrinter::mkindent(int delta) {
   indent += delta;
+  if (json()) {
+    return true;
+  }
   for (int i = 0; i < indent; i++) {
     os << ' ';
   }
@@ -204,20 +304,38 @@ bool PrettyPrinter::mkindent(int delta) {
 }
 
 bool PrettyPrinter::nl(int delta) {
+  if (json()) {
+    indent += delta;
+    return true;
+  }
   os << std::endl;
   return mkindent(delta);
 }
 bool PrettyPrinter::raw_nl(int delta) {
-  os << std::endl;
   indent += delta;
+  if (json()) {
+    return true;
+  }
+  os << std::endl;
   nl_used = true;
   return true;
 }
 
 bool PrettyPrinter::open(std::string msg) {
-  os << "(" << msg;
   indent += 2;
   level++;
+  if (json()) {
+    json_value();
+    os << '{';
+    json_fields.push_back(0);
+    if (!msg.empty()) {
+      json_field("@type");
+      json_string(msg);
+      json_value();
+    }
+    return true;
+  }
+  os << "(" << msg;
   return true;
 }
 
@@ -231,12 +349,20 @@ bool PrettyPrinter::close(std::string msg) {
   }
   indent -= 2;
   --level;
+  if (json()) {
+    json_fields.pop_back();
+    os << '}';
+    return true;
+  }
   os << msg << ")";
   return true;
 }
 
 bool PrettyPrinter::mode_nl() {
-  if (mode & 1) {
+  if (json()) {
+    return true;
+  }
+  if (mode & m_nl) {
     return nl();
   } else {
     os << ' ';
@@ -245,42 +371,137 @@ bool PrettyPrinter::mode_nl() {
 }
 
 bool PrettyPrinter::field(std::string name) {
+  if (json()) {
+    return json_field(name);
+  }
   mode_nl();
   os << name << ':';
   return true;
 }
 
 bool PrettyPrinter::field() {
+  if (json()) {
+    // unnamed fields are keyed by their position in the constructor
+    return json_field("_" + std::to_string(json_fields.empty() ? 0 : json_fields.back()));
+  }
   mode_nl();
   return true;
 }
 
+bool PrettyPrinter::out(std::string str) {
+  if (json()) {
+    json_value();
+    json_string(str);
+    return true;
+  }
+  os << str;
+  return true;
+}
+
+bool PrettyPrinter::out_int(long long value) {
+  if (json()) {
+    json_value();
+  }
+  os << value;
+  return true;
+}
+
+bool PrettyPrinter::out_uint(unsigned long long value) {
+  if (json()) {
+    json_value();
+  }
+  os << value;
+  return true;
+}
+
+bool PrettyPrinter::out_integer(td::RefInt256 value) {
+  if (value.is_null()) {
+    return false;
+  }
+  if (json()) {
+    // wider than a double can hold exactly
+    json_value();
+    os << '"' << std::move(value) << '"';
+    return true;
+  }
+  os << std::move(value);
+  return true;
+}
+
+bool PrettyPrinter::out_bool(bool value) {
+  if (json()) {
+    json_value();
+    os << (value ? "true" : "false");
+    return true;
+  }
+  return out(value ? "bool_true" : "bool_false");
+}
+
+bool PrettyPrinter::out_null() {
+  if (json()) {
+    json_value();
+    os << "null";
+    return true;
+  }
+  return out("()");
+}
+
+bool PrettyPrinter::cons(std::string str) {
+  if (json()) {
+    // a constructor without fields
+    json_value();
+    os << "{\"@type\":";
+    json_string(str);
+    os << '}';
+    return true;
+  }
+  return out(str);
+}
+
 bool PrettyPrinter::field_int(long long x, std::string name) {
+  if (json()) {
+    return json_field(name) && out_int(x);
+  }
   os << ' ' << name << ':' << x;
   return true;
 }
 
 bool PrettyPrinter::field_int(long long x) {
+  if (json()) {
+    return field() && out_int(x);
+  }
   os << ' ' << x;
   return true;
 }
 
 bool PrettyPrinter::field_uint(unsigned long long x, std::string name) {
+  if (json()) {
+    return json_field(name) && out_uint(x);
+  }
   os << ' ' << name << ':' << x;
   return true;
 }
 
 bool PrettyPrinter::field_uint(unsigned long long x) {
+  if (json()) {
+    return field() && out_uint(x);
+  }
   os << ' ' << x;
   return true;
 }
 
 bool PrettyPrinter::fetch_bits_field(vm::CellSlice& cs, int n) {
+  if (json()) {
+    return cs.have(n) && field() && out(cs.fetch_bits(n).to_hex());
+  }
   os << " x";
   return cs.have(n) && out(cs.fetch_bits(n).to_hex());
 }
 
 bool PrettyPrinter::fetch_bits_field(vm::CellSlice& cs, int n, std::string name) {
+  if (json()) {
+    return cs.have(n) && json_field(name) && out(cs.fetch_bits(n).to_hex());
+  }
   os << ' ' << name << ":x";
   return cs.have(n) && out(cs.fetch_bits(n).to_hex());
 }
@@ -302,21 +523,33 @@ bool PrettyPrinter::fetch_uint_field(vm::CellSlice& cs, int n, std::string name)
 }
 
 bool PrettyPrinter::fetch_int256_field(vm::CellSlice& cs, int n) {
+  if (json()) {
+    return field() && out_integer(cs.fetch_int256(n, true));
+  }
   os << ' ';
   return out_integer(cs.fetch_int256(n, true));
 }
 
 bool PrettyPrinter::fetch_int256_field(vm::CellSlice& cs, int n, std::string name) {
+  if (json()) {
+    return json_field(name) && out_integer(cs.fetch_int256(n, true));
+  }
   os << ' ' << name << ':';
   return out_integer(cs.fetch_int256(n, true));
 }
 
 bool PrettyPrinter::fetch_uint256_field(vm::CellSlice& cs, int n) {
+  if (json()) {
+    return field() && out_integer(cs.fetch_int256(n, false));
+  }
   os << ' ';
   return out_integer(cs.fetch_int256(n, false));
 }
 
 bool PrettyPrinter::fetch_uint256_field(vm::CellSlice& cs, int n, std::string name) {
+  if (json()) {
+    return json_field(name) && out_integer(cs.fetch_int256(n, false));
+  }
   os << ' ' << name << ':';
   return out_integer(cs.fetch_int256(n, false));
 }
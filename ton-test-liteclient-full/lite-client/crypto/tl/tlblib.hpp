@@ -1,5 +1,7 @@
 #pragma once
 #include <iostream>
+#include <string>
+#include <vector>
 #include "vm/cellslice.h"
 
 namespace tlb {
@@ -159,6 +161,10 @@ class TLB {
     return print(os, *cs_ref, indent);
   }
   bool print_ref(std::ostream& os, Ref<vm::Cell> cell_ref, int indent = 0) const;
+  // same traversal as print(), but the value is written as JSON: constructors become objects
+  // with an "@type" member and named fields, integers up to 64 bits are numbers, wider ones strings
+  bool print_json(std::ostream& os, const vm::CellSlice& cs) const;
+  bool print_ref_json(std::ostream& os, Ref<vm::Cell> cell_ref) const;
   std::string as_string_skip(vm::CellSlice& cs, int indent = 0) const;
   std::string as_string(const vm::CellSlice& cs, int indent = 0) const;
   std::string as_string(Ref<vm::CellSlice> cs_ref, int indent = 0) const {
@@ -369,19 +375,23 @@ bool store_from(vm::CellBuilder& cb, const T& tlb_type, Ref<vm::CellSlice> field
 namespace tlb {
 
 struct PrettyPrinter {
+  enum { m_nl = 1, m_json = 2 };
   std::ostream& os;
   int indent;
   int level;
   bool failed;
   bool nl_used;
   int mode;
-  PrettyPrinter(std::ostream& _os, int _indent = 0, int _mode = 1)
+  PrettyPrinter(std::ostream& _os, int _indent = 0, int _mode = m_nl)
       : os(_os), indent(_indent), level(0), failed(false), nl_used(false), mode(_mode) {
   }
   ~PrettyPrinter();
   bool ok() const {
     return !failed && !level;
   }
+  bool json() const {
+    return mode & m_json;
+  }
   bool fail_unless(bool res) {
     if (!res) {
       failed = true;
@@ -402,29 +412,13 @@ struct PrettyPrinter {
   bool field_int(long long value, std::string name);
   bool field_uint(unsigned long long value);
   bool field_uint(unsigned long long value, std::string name);
-  bool out(std::string str) {
-    os << str;
-    return true;
-  }
-  bool out_int(long long value) {
-    os << value;
-    return true;
-  }
-  bool out_uint(unsigned long long value) {
-    os << value;
-    return true;
-  }
-  bool out_integer(td::RefInt256 value) {
-    if (value.not_null()) {
-      os << std::move(value);
-      return true;
-    } else {
-      return false;
-    }
-  }
-  bool cons(std::string str) {
-    return out(str);
-  }
+  bool out(std::string str);
+  bool out_int(long long value);
+  bool out_uint(unsigned long long value);
+  bool out_integer(td::RefInt256 value);
+  bool out_bool(bool value);
+  bool out_null();
+  bool cons(std::string str);
   bool fetch_bits_field(vm::CellSlice& cs, int n);
   bool fetch_bits_field(vm::CellSlice& cs, int n, std::string name);
   bool fetch_int_field(vm::CellSlice& cs, int n);
@@ -440,6 +434,18 @@ struct PrettyPrinter {
     os << value;
     return *this;
   }
+
+ private:
+  // JSON output state: fields written at each open level, a field name waiting for its value,
+  // whether anything has been written at all, and the first failure message
+  std::vector<int> json_fields;
+  bool json_value_expected{false};
+  bool json_started{false};
+  std::string json_error;
+
+  bool json_field(std::string name);
+  void json_value();
+  void json_string(const std::string& str);
 };
 
 }  // namespace tlb
@@ -61,8 +61,14 @@ int exec_push_int(VmState* st, CellSlice& cs, unsigned args, int pfx_bits) {
     throw VmError{Excno::inv_opcode, "not enough bits for integer constant in PUSHINT"};
   }
   cs.advance(pfx_bits);
-  td::RefInt256 x = cs.fetch_int256(3 + l * 8);
   Stack& stack = st->get_stack();
+  if (3 + l * 8 <= 64) {
+    long long x = cs.fetch_long(3 + l * 8);
+    VM_LOG(st) << "execute PUSHINT " << x;
+    stack.push_smallint(x);
+    return 0;
+  }
+  td::RefInt256 x = cs.fetch_int256(3 + l * 8);
   VM_LOG(st) << "execute PUSHINT " << x;
   stack.push_int(std::move(x));
   return 0;
@@ -141,10 +147,38 @@ void register_int_const_ops(OpcodeTable& cp0) {
       .insert(OpcodeInstr::mkfixed(0x85, 8, 8, instr::dump_1c_l_add(1, "PUSHNEGPOW2 "), exec_push_negpow2));
 }
 
+namespace {
+// fast paths for integers kept inline by the stack, the general code is used if a result doesn't fit into 64 bits;
+// the results are the same, so is the gas (never depending on the representation of integers)
+bool are_smallints(const Stack& stack, int cnt) {
+  for (int i = 0; i < cnt; i++) {
+    if (!stack[i].is_smallint()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// replaces top cnt entries of the stack with res if it fits into 64 bits
+bool set_smallint_result(Stack& stack, int cnt, __int128 res) {
+  auto val = static_cast<long long>(res);
+  if (val != res) {
+    return false;
+  }
+  stack.pop_many(cnt);
+  stack.push_smallint(val);
+  return true;
+}
+}  // namespace
+
 int exec_add(VmState* st, bool quiet) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute ADD";
   stack.check_underflow(2);
+  if (are_smallints(stack, 2) &&
+      set_smallint_result(stack, 2, (__int128)stack[1].as_smallint() + stack[0].as_smallint())) {
+    return 0;
+  }
   auto y = stack.pop_int();
   stack.push_int_quiet(stack.pop_int() + std::move(y), quiet);
   return 0;
@@ -154,6 +188,10 @@ int exec_sub(VmState* st, bool quiet) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute SUB";
   stack.check_underflow(2);
+  if (are_smallints(stack, 2) &&
+      set_smallint_result(stack, 2, (__int128)stack[1].as_smallint() - stack[0].as_smallint())) {
+    return 0;
+  }
   auto y = stack.pop_int();
   stack.push_int_quiet(stack.pop_int() - std::move(y), quiet);
   return 0;
@@ -163,6 +201,10 @@ int exec_subr(VmState* st, bool quiet) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute SUBR";
   stack.check_underflow(2);
+  if (are_smallints(stack, 2) &&
+      set_smallint_result(stack, 2, (__int128)stack[0].as_smallint() - stack[1].as_smallint())) {
+    return 0;
+  }
   auto y = stack.pop_int();
   stack.push_int_quiet(std::move(y) - stack.pop_int(), quiet);
   return 0;
@@ -172,6 +214,9 @@ int exec_negate(VmState* st, bool quiet) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute NEGATE";
   stack.check_underflow(1);
+  if (are_smallints(stack, 1) && set_smallint_result(stack, 1, -(__int128)stack[0].as_smallint())) {
+    return 0;
+  }
   stack.push_int_quiet(-stack.pop_int(), quiet);
   return 0;
 }
@@ -180,6 +225,9 @@ int exec_inc(VmState* st, bool quiet) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute INC";
   stack.check_underflow(1);
+  if (are_smallints(stack, 1) && set_smallint_result(stack, 1, (__int128)stack[0].as_smallint() + 1)) {
+    return 0;
+  }
   stack.push_int_quiet(stack.pop_int() + 1, quiet);
   return 0;
 }
@@ -188,6 +236,9 @@ int exec_dec(VmState* st, bool quiet) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute DEC";
   stack.check_underflow(1);
+  if (are_smallints(stack, 1) && set_smallint_result(stack, 1, (__int128)stack[0].as_smallint() - 1)) {
+    return 0;
+  }
   stack.push_int_quiet(stack.pop_int() - 1, quiet);
   return 0;
 }
@@ -197,6 +248,9 @@ int exec_add_tinyint8(VmState* st, unsigned args, bool quiet) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute ADDINT " << x;
   stack.check_underflow(1);
+  if (are_smallints(stack, 1) && set_smallint_result(stack, 1, (__int128)stack[0].as_smallint() + x)) {
+    return 0;
+  }
   stack.push_int_quiet(stack.pop_int() + x, quiet);
   return 0;
 }
@@ -206,6 +260,9 @@ int exec_mul_tinyint8(VmState* st, unsigned args, bool quiet) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute MULINT " << x;
   stack.check_underflow(1);
+  if (are_smallints(stack, 1) && set_smallint_result(stack, 1, (__int128)stack[0].as_smallint() * x)) {
+    return 0;
+  }
   stack.push_int_quiet(stack.pop_int() * x, quiet);
   return 0;
 }
@@ -214,6 +271,10 @@ int exec_mul(VmState* st, bool quiet) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute MUL";
   stack.check_underflow(2);
+  if (are_smallints(stack, 2) &&
+      set_smallint_result(stack, 2, (__int128)stack[1].as_smallint() * stack[0].as_smallint())) {
+    return 0;
+  }
   auto y = stack.pop_int();
   stack.push_int_quiet(stack.pop_int() * std::move(y), quiet);
   return 0;
@@ -253,6 +314,35 @@ int exec_divmod(VmState* st, unsigned args, int quiet) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute DIV/MOD " << (args & 15);
   stack.check_underflow(2);
+  if (round_mode == -1 && are_smallints(stack, 2) && stack[0].as_smallint() != 0 &&
+      stack[0].as_smallint() >= -td::BigIntInfo::Half && stack[0].as_smallint() < td::BigIntInfo::Half) {
+    // floor division by a single-digit divisor, the general code handles division by zero
+    // and (not quite exactly) by larger divisors
+    __int128 x = stack[1].as_smallint(), y = stack[0].as_smallint();
+    __int128 q = x / y, r = x % y;
+    if (r != 0 && (r < 0) != (y < 0)) {
+      q--;
+      r += y;
+    }
+    switch ((args >> 2) & 3) {
+      case 1:
+        if (set_smallint_result(stack, 2, q)) {
+          return 0;
+        }
+        break;
+      case 2:
+        if (set_smallint_result(stack, 2, r)) {
+          return 0;
+        }
+        break;
+      case 3:
+        if (set_smallint_result(stack, 2, q)) {
+          stack.push_smallint(static_cast<long long>(r));
+          return 0;
+        }
+        break;
+    }
+  }
   auto y = stack.pop_int();
   auto x = stack.pop_int();
   switch ((args >> 2) & 3) {
@@ -820,6 +910,12 @@ int exec_sgn(VmState* st, int mode, bool quiet, const char* name) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute " << name;
   stack.check_underflow(1);
+  if (are_smallints(stack, 1)) {
+    auto x = stack.pop().as_smallint();
+    int y = (x > 0) - (x < 0);
+    stack.push_smallint(((mode >> (4 + y * 4)) & 15) - 8);
+    return 0;
+  }
   auto x = stack.pop_int();
   if (!x->is_valid()) {
     stack.push_int_quiet(std::move(x), quiet);
@@ -834,6 +930,13 @@ int exec_cmp(VmState* st, int mode, bool quiet, const char* name) {
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute " << name;
   stack.check_underflow(2);
+  if (are_smallints(stack, 2)) {
+    auto y = stack.pop().as_smallint();
+    auto x = stack.pop().as_smallint();
+    int z = (x > y) - (x < y);
+    stack.push_smallint(((mode >> (4 + z * 4)) & 15) - 8);
+    return 0;
+  }
   auto y = stack.pop_int();
   auto x = stack.pop_int();
   if (!x->is_valid() || !y->is_valid()) {
@@ -850,6 +953,12 @@ int exec_cmp_int(VmState* st, unsigned args, int mode, bool quiet, const char* n
   Stack& stack = st->get_stack();
   VM_LOG(st) << "execute " << name << "INT " << y;
   stack.check_underflow(1);
+  if (are_smallints(stack, 1)) {
+    auto x = stack.pop().as_smallint();
+    int z = (x > y) - (x < y);
+    stack.push_smallint(((mode >> (4 + z * 4)) & 15) - 8);
+    return 0;
+  }
   auto x = stack.pop_int();
   if (!x->is_valid()) {
     stack.push_int_quiet(std::move(x), quiet);
@@ -1,6 +1,9 @@
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include "vm/boc.h"
 #include "vm/cells.h"
 #include "vm/cellslice.h"
@@ -8,6 +11,8 @@
 #include "td/utils/Slice-decl.h"
 #include "td/utils/format.h"
 #include "td/utils/crypto.h"
+#include "td/utils/misc.h"
+#include "td/utils/port/thread.h"
 
 namespace vm {
 using td::Ref;
@@ -67,8 +72,8 @@ td::Result<int> CellSerializationInfo::get_bits(td::Slice cell) const {
 }
 
 // TODO: check usage when result is empty
-td::Result<Ref<DataCell>> CellSerializationInfo::create_data_cell(td::Slice cell_slice,
-                                                                  td::Span<Ref<Cell>> refs) const {
+td::Result<Ref<DataCell>> CellSerializationInfo::create_data_cell(td::Slice cell_slice, td::Span<Ref<Cell>> refs,
+                                                                  DataCell::HashBatch* batch) const {
   CellBuilder cb;
   TRY_RESULT(bits, get_bits(cell_slice));
   cb.store_bits(cell_slice.ubegin() + data_offset, bits);
@@ -76,10 +81,13 @@ td::Result<Ref<DataCell>> CellSerializationInfo::create_data_cell(td::Slice cell
   for (int k = 0; k < refs_cnt; k++) {
     cb.store_ref(std::move(refs[k]));
   }
-  auto res = cb.finalize(special);
+  TRY_RESULT(res, cb.finalize_nothrow(special, batch));
   if (res.is_null()) {
     return td::Status::Error("CellBuilder::finalize failed");
   }
+  if (with_hashes && batch) {
+    batch->flush();
+  }
   if (res->is_special() != special) {
     return td::Status::Error("is_special missmatch");
   }
@@ -173,6 +181,8 @@ td::Status BagOfCells::import_cells() {
     root.idx = res.move_as_ok();
   }
   //LOG(INFO) << "[cells: " << cell_count << ", refs: " << int_refs << ", bytes: " << data_bytes << "]";
+  // the hash table is needed only to find duplicates while importing; for big bags it is the largest structure
+  decltype(cells)().swap(cells);
   reorder_cells();
   //LOG(INFO) << "[cells: " << cell_count << ", refs: " << int_refs << ", bytes: " << data_bytes
   //<< ", internal hashes: " << int_hashes << ", top hashes: " << top_hashes << "]";
@@ -461,16 +471,91 @@ std::string BagOfCells::extract_string() const {
   return std::string{serialized.data(), serialized.data() + serialized.size()};
 }
 
-void BagOfCells::store_uint(unsigned long long value, unsigned bytes) {
-  unsigned char* ptr = store_ptr += bytes;
-  store_chk();
-  while (bytes) {
-    *--ptr = value & 0xff;
+namespace {
+// Destinations of BagOfCells::serialize_to_impl: a buffer of exactly the estimated size,
+// or a fixed-size buffer which is handed to a callback whenever it fills up.
+class BocBufferWriter {
+ public:
+  BocBufferWriter(unsigned char* begin, unsigned char* end) : begin_(begin), ptr_(begin), end_(end) {
+  }
+  td::MutableSlice prepare(std::size_t size) {
+    return td::MutableSlice(ptr_, std::min<std::size_t>(size, end_ - ptr_));
+  }
+  void confirm(std::size_t size) {
+    ptr_ += size;
+    DCHECK(ptr_ <= end_);
+  }
+  td::uint32 crc32c() const {
+    return td::crc32c(td::Slice(begin_, ptr_));
+  }
+  std::size_t position() const {
+    return ptr_ - begin_;
+  }
+
+ private:
+  unsigned char* begin_;
+  unsigned char* ptr_;
+  unsigned char* end_;
+};
+
+class BocStreamWriter {
+ public:
+  BocStreamWriter(std::size_t buffer_size, const std::function<td::Status(td::Slice)>& write)
+      : buffer_(td::max<std::size_t>(buffer_size, 4096)), write_(write) {
+  }
+  td::MutableSlice prepare(std::size_t size) {
+    if (buffer_.size() - pos_ < size) {
+      flush();
+    }
+    return td::MutableSlice(buffer_.data() + pos_, std::min(size, buffer_.size() - pos_));
+  }
+  void confirm(std::size_t size) {
+    pos_ += size;
+    written_ += size;
+  }
+  td::uint32 crc32c() {
+    update_crc();
+    return crc_;
+  }
+  std::size_t position() const {
+    return written_;
+  }
+  td::Status finish() {
+    flush();
+    return std::move(status_);
+  }
+
+ private:
+  std::vector<unsigned char> buffer_;
+  const std::function<td::Status(td::Slice)>& write_;
+  std::size_t pos_{0}, crc_pos_{0}, written_{0};
+  td::uint32 crc_{0};
+  td::Status status_;
+
+  void update_crc() {
+    crc_ = td::crc32c_extend(crc_, td::Slice(buffer_.data() + crc_pos_, buffer_.data() + pos_));
+    crc_pos_ = pos_;
+  }
+  void flush() {
+    update_crc();
+    if (status_.is_ok() && pos_ > 0) {
+      status_ = write_(td::Slice(buffer_.data(), pos_));
+    }
+    pos_ = crc_pos_ = 0;
+  }
+};
+
+template <class WriterT>
+void store_uint(WriterT& writer, unsigned long long value, unsigned bytes) {
+  auto dest = writer.prepare(bytes);
+  CHECK(dest.size() == bytes);
+  for (unsigned i = bytes; i > 0; i--) {
+    dest[i - 1] = static_cast<char>(value & 0xff);
     value >>= 8;
-    --bytes;
   }
-  DCHECK(!bytes);
+  writer.confirm(bytes);
 }
+}  // namespace
 
 //serialized_boc#672fb0ac has_idx:(## 1) has_crc32c:(## 1)
 //  has_cache_bits:(## 1) flags:(## 2) { flags = 0 }
@@ -488,8 +573,56 @@ std::size_t BagOfCells::serialize_to(unsigned char* buffer, std::size_t buff_siz
   if (!size_est || size_est > buff_size) {
     return 0;
   }
-  init_store(buffer, buffer + size_est);
-  store_uint(info.magic, 4);
+  BocBufferWriter writer(buffer, buffer + size_est);
+  auto size = serialize_to_impl(writer, mode);
+  DCHECK(!size || size == size_est);
+  return size;
+}
+
+// The header and the index are computed from cell_list_ alone, so the serialization is produced front to back
+// and only `buffer_size` bytes of it are kept in memory at once.
+td::Status BagOfCells::serialize_to_stream(const std::function<td::Status(td::Slice)>& write, int mode,
+                                           std::size_t buffer_size) {
+  std::size_t size_est = estimate_serialized_size(mode);
+  if (!size_est) {
+    return td::Status::Error("no cells to serialize to this bag of cells");
+  }
+  BocStreamWriter writer(std::min(buffer_size, size_est), write);
+  auto size = serialize_to_impl(writer, mode);
+  TRY_STATUS(writer.finish());
+  if (size != size_est) {
+    return td::Status::Error("error while serializing a bag of cells: actual serialized size differs from estimated");
+  }
+  return td::Status::OK();
+}
+
+td::Status BagOfCells::serialize_to_file(td::FileFd& fd, int mode, std::size_t buffer_size) {
+  return serialize_to_stream(
+      [&fd](td::Slice data) {
+        while (!data.empty()) {
+          TRY_RESULT(written, fd.write(data));
+          data.remove_prefix(written);
+        }
+        return td::Status::OK();
+      },
+      mode, buffer_size);
+}
+
+td::Status BagOfCells::serialize_to_buffer(td::ChainBufferWriter& output, int mode, std::size_t buffer_size) {
+  return serialize_to_stream(
+      [&output](td::Slice data) {
+        output.append(data);
+        return td::Status::OK();
+      },
+      mode, buffer_size);
+}
+
+template <class WriterT>
+std::size_t BagOfCells::serialize_to_impl(WriterT& writer, int mode) {
+  auto store_ref = [&](unsigned long long value) { store_uint(writer, value, info.ref_byte_size); };
+  auto store_offset = [&](unsigned long long value) { store_uint(writer, value, info.offset_byte_size); };
+
+  store_uint(writer, info.magic, 4);
 
   td::uint8 byte{0};
   if (info.has_index) {
@@ -506,9 +639,9 @@ std::size_t BagOfCells::serialize_to(unsigned char* buffer, std::size_t buff_siz
     return 0;
   }
   byte |= static_cast<td::uint8>(info.ref_byte_size);
-  store_uint(byte, 1);
+  store_uint(writer, byte, 1);
 
-  store_uint(info.offset_byte_size, 1);
+  store_uint(writer, info.offset_byte_size, 1);
   store_ref(cell_count);
   store_ref(root_count);
   store_ref(0);
@@ -518,7 +651,7 @@ std::size_t BagOfCells::serialize_to(unsigned char* buffer, std::size_t buff_siz
     DCHECK(k >= 0 && k < cell_count);
     store_ref(k);
   }
-  DCHECK(store_ptr - buffer == (long long)info.index_offset);
+  DCHECK(writer.position() == info.index_offset);
   DCHECK((unsigned)cell_count == cell_list_.size());
   if (info.has_index) {
     std::size_t offs = 0;
@@ -537,8 +670,7 @@ std::size_t BagOfCells::serialize_to(unsigned char* buffer, std::size_t buff_siz
     }
     DCHECK(offs == info.data_size);
   }
-  DCHECK(store_ptr - buffer == (long long)info.data_offset);
-  unsigned char* keep_ptr = store_ptr;
+  DCHECK(writer.position() == info.data_offset);
   for (int i = 0; i < cell_count; ++i) {
     const auto& dc_info = cell_list_[cell_count - 1 - i];
     const Ref<DataCell>& dc = dc_info.dc_ref;
@@ -546,29 +678,22 @@ std::size_t BagOfCells::serialize_to(unsigned char* buffer, std::size_t buff_siz
     if (dc_info.is_root_cell && (mode & Mode::WithTopHash)) {
       with_hash = true;
     }
-    int s = dc->serialize(store_ptr, 256, with_hash);
-    store_ptr += s;
-    store_chk();
+    auto dest = writer.prepare(256);
+    int s = dc->serialize(dest.ubegin(), static_cast<int>(dest.size()), with_hash);
+    CHECK(s > 0);
+    writer.confirm(s);
     DCHECK(dc->size_refs() == dc_info.ref_num);
-    // std::cerr << (dc_info.is_special() ? '*' : ' ') << i << '<' << (int)dc_info.wt << ">:";
     for (unsigned j = 0; j < dc_info.ref_num; ++j) {
       int k = cell_count - 1 - dc_info.ref_idx[j];
       DCHECK(k > i && k < cell_count);
       store_ref(k);
-      // std::cerr << ' ' << k;
     }
-    // std::cerr << std::endl;
   }
-  store_chk();
-  DCHECK(store_ptr - keep_ptr == (long long)info.data_size);
-  DCHECK(store_end - store_ptr == (info.has_crc32c ? 4 : 0));
+  DCHECK(writer.position() == info.data_offset + info.data_size);
   if (info.has_crc32c) {
-    // compute crc32c of buffer .. store_ptr
-    unsigned crc = td::crc32c(td::Slice{buffer, store_ptr});
-    store_uint(td::bswap32(crc), 4);
+    store_uint(writer, td::bswap32(writer.crc32c()), 4);
   }
-  DCHECK(store_empty());
-  return store_ptr - buffer;
+  return writer.position();
 }
 
 unsigned long long BagOfCells::Info::read_int(const unsigned char* ptr, unsigned bytes) {
@@ -698,7 +823,8 @@ td::Result<td::Slice> BagOfCells::get_cell_slice(int idx, td::Slice data) {
 
 td::Result<td::Ref<vm::DataCell>> BagOfCells::deserialize_cell(int idx, td::Slice cells_slice,
                                                                td::Span<td::Ref<DataCell>> cells_span,
-                                                               std::vector<td::uint8>* cell_should_cache) {
+                                                               std::vector<td::uint8>* cell_should_cache,
+                                                               DataCell::HashBatch* batch) {
   TRY_RESULT(cell_slice, get_cell_slice(idx, cells_slice));
   std::array<td::Ref<Cell>, 4> refs_buf;
 
@@ -729,10 +855,137 @@ td::Result<td::Ref<vm::DataCell>> BagOfCells::deserialize_cell(int idx, td::Slic
     }
   }
 
-  return cell_info.create_data_cell(cell_slice, refs);
+  return cell_info.create_data_cell(cell_slice, refs, batch);
 }
 
-td::Result<long long> BagOfCells::deserialize(const td::Slice& data) {
+// Cell #idx refers only to cells with larger indices, i.e. to cells at smaller positions of cell_list.
+// Cells are split into layers, a cell being one layer above the highest of the cells it refers to;
+// the cells of one layer are independent, so a wide layer is created by all threads at once.
+// Consecutive narrow layers are created by one thread while the others wait.
+td::Status BagOfCells::deserialize_cells_parallel(td::Slice cells_slice, td::MutableSpan<td::Ref<DataCell>> cell_list,
+                                                  std::vector<td::uint8>* cell_should_cache, int threads_n) {
+  std::vector<int> layer(cell_count);
+  int max_layer = 0;
+  for (int i = 0; i < cell_count; i++) {
+    int idx = cell_count - 1 - i;
+    auto r_slice = get_cell_slice(idx, cells_slice);
+    CellSerializationInfo cell_info;
+    auto status = r_slice.is_ok() ? cell_info.init(r_slice.ok(), info.ref_byte_size) : r_slice.move_as_error();
+    if (status.is_error()) {
+      return td::Status::Error(PSLICE() << "invalid bag-of-cells failed to deserialize cell #" << idx << " "
+                                        << status.error());
+    }
+    for (int k = 0; k < cell_info.refs_cnt; k++) {
+      int ref_idx = (int)info.read_ref(r_slice.ok().ubegin() + cell_info.refs_offset + k * info.ref_byte_size);
+      if (ref_idx <= idx || ref_idx >= cell_count) {
+        // let deserialize_cell describe the error
+        auto r_cell = deserialize_cell(idx, cells_slice, cell_list, nullptr);
+        CHECK(r_cell.is_error());
+        return td::Status::Error(PSLICE() << "invalid bag-of-cells failed to deserialize cell #" << idx << " "
+                                          << r_cell.error());
+      }
+      layer[i] = std::max(layer[i], layer[cell_count - 1 - ref_idx] + 1);
+      if (cell_should_cache) {
+        auto& cnt = (*cell_should_cache)[ref_idx];
+        if (cnt < 2) {
+          cnt++;
+        }
+      }
+    }
+    max_layer = std::max(max_layer, layer[i]);
+  }
+
+  // positions of cell_list ordered by layer
+  std::vector<int> layer_begin(max_layer + 2, 0);
+  for (auto l : layer) {
+    layer_begin[l + 1]++;
+  }
+  for (int l = 0; l <= max_layer; l++) {
+    layer_begin[l + 1] += layer_begin[l];
+  }
+  std::vector<int> order(cell_count);
+  {
+    auto next = layer_begin;
+    for (int i = 0; i < cell_count; i++) {
+      order[next[layer[i]]++] = i;
+    }
+  }
+  layer = {};
+
+  struct Stage {
+    int begin, end;
+    int chunk;  // 0 for a run of narrow layers
+  };
+  std::vector<Stage> stages;
+  const int min_wide_layer = threads_n * 16;
+  for (int l = 0; l <= max_layer; l++) {
+    int begin = layer_begin[l], end = layer_begin[l + 1];
+    if (end - begin >= min_wide_layer) {
+      stages.push_back(Stage{begin, end, td::clamp((end - begin) / (threads_n * 4), 16, 1024)});
+    } else if (!stages.empty() && stages.back().chunk == 0) {
+      stages.back().end = end;
+    } else {
+      stages.push_back(Stage{begin, end, 0});
+    }
+  }
+
+  std::vector<std::atomic<int>> stage_next(stages.size());
+  std::atomic<int> arrived{0};
+  std::atomic<bool> failed{false};
+  std::mutex error_mutex;
+  td::Status error;
+  auto create_cell = [&](int i, DataCell::HashBatch& batch) {
+    int idx = cell_count - 1 - i;
+    auto r_cell = deserialize_cell(idx, cells_slice, cell_list, nullptr, &batch);
+    if (r_cell.is_error()) {
+      std::lock_guard<std::mutex> guard(error_mutex);
+      if (!failed.exchange(true)) {
+        error = td::Status::Error(PSLICE() << "invalid bag-of-cells failed to deserialize cell #" << idx << " "
+                                           << r_cell.error());
+      }
+      return;
+    }
+    cell_list[i] = r_cell.move_as_ok();
+  };
+  auto run = [&](int thread_i) {
+    DataCell::HashBatch batch;
+    for (size_t s = 0; s < stages.size(); s++) {
+      auto& stage = stages[s];
+      if (stage.chunk == 0) {
+        for (int j = stage.begin; thread_i == 0 && j < stage.end && !failed.load(std::memory_order_relaxed); j++) {
+          create_cell(order[j], batch);
+        }
+      } else {
+        while (!failed.load(std::memory_order_relaxed)) {
+          int begin = stage.begin + stage_next[s].fetch_add(stage.chunk, std::memory_order_relaxed);
+          if (begin >= stage.end) {
+            break;
+          }
+          for (int j = begin, end = std::min(begin + stage.chunk, stage.end); j < end; j++) {
+            create_cell(order[j], batch);
+          }
+        }
+      }
+      // the next stages read hashes of this one
+      batch.flush();
+      arrived.fetch_add(1, std::memory_order_release);
+      while (arrived.load(std::memory_order_acquire) < threads_n * static_cast<int>(s + 1)) {
+        td::this_thread::yield();
+      }
+    }
+  };
+  std::vector<td::thread> threads;
+  for (int t = 1; t < threads_n; t++) {
+    threads.emplace_back(run, t);
+  }
+  run(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return error;
+}
+
+td::Result<long long> BagOfCells::deserialize(const td::Slice& data, int threads_n) {
   clear();
   long long size_est = info.parse_serialized_header(data);
   //LOG(INFO) << "estimated size " << size_est << ", true size " << data.size();
@@ -753,7 +1006,7 @@ td::Result<long long> BagOfCells::deserialize(const td::Slice& data) {
   }
   //LOG(INFO) << "estimated size " << size_est << ", true size " << data.size();
   if (info.has_crc32c) {
-    unsigned crc_computed = td::crc32c(td::Slice{data.ubegin(), data.uend() - 4});
+    unsigned crc_computed = td::crc32c_parallel(td::Slice{data.ubegin(), data.uend() - 4}, threads_n);
     unsigned crc_stored = td::as<unsigned>(data.uend() - 4);
     if (crc_computed != crc_stored) {
       return td::Status::Error(PSLICE() << "bag-of-cells CRC32C mismatch: expected " << td::format::as_hex(crc_computed)
@@ -813,18 +1066,33 @@ td::Result<long long> BagOfCells::deserialize(const td::Slice& data) {
   }
   auto cells_slice = data.substr(info.data_offset, info.data_size);
   std::vector<Ref<DataCell>> cell_list;
-  cell_list.reserve(cell_count);
-  std::array<td::Ref<Cell>, 4> refs_buf;
-  for (int i = 0; i < cell_count; i++) {
-    // reconstruct cell with index cell_count - 1 - i
-    int idx = cell_count - 1 - i;
-    auto r_cell = deserialize_cell(idx, cells_slice, cell_list, info.has_cache_bits ? &cell_should_cache : nullptr);
-    if (r_cell.is_error()) {
-      return td::Status::Error(PSLICE() << "invalid bag-of-cells failed to deserialize cell #" << idx << " "
-                                        << r_cell.error());
+  if (threads_n > 1) {
+    cell_list.resize(cell_count);
+    if (deserialize_cells_parallel(cells_slice, cell_list, info.has_cache_bits ? &cell_should_cache : nullptr,
+                                   threads_n)
+            .is_error()) {
+      // the threads stop at whichever bad cell they meet first; the sequential pass below reports the same cell
+      // (and the same error) as it would have without threads
+      cell_list.clear();
+      threads_n = 1;
+    }
+  }
+  if (threads_n <= 1) {
+    cell_list.reserve(cell_count);
+    // siblings are hashed together; a cell referring to a cell still waiting for its hash flushes the batch
+    DataCell::HashBatch batch;
+    for (int i = 0; i < cell_count; i++) {
+      // reconstruct cell with index cell_count - 1 - i
+      int idx = cell_count - 1 - i;
+      auto r_cell =
+          deserialize_cell(idx, cells_slice, cell_list, info.has_cache_bits ? &cell_should_cache : nullptr, &batch);
+      if (r_cell.is_error()) {
+        return td::Status::Error(PSLICE() << "invalid bag-of-cells failed to deserialize cell #" << idx << " "
+                                          << r_cell.error());
+      }
+      cell_list.push_back(r_cell.move_as_ok());
+      DCHECK(cell_list.back().not_null());
     }
-    cell_list.push_back(r_cell.move_as_ok());
-    DCHECK(cell_list.back().not_null());
   }
   if (info.has_cache_bits) {
     for (int idx = 0; idx < cell_count; idx++) {
@@ -886,9 +1154,9 @@ unsigned long long BagOfCells::get_idx_entry_raw(int index) {
  * 
  */
 
-td::Result<Ref<Cell>> std_boc_deserialize(td::Slice data) {
+td::Result<Ref<Cell>> std_boc_deserialize(td::Slice data, int threads_n) {
   BagOfCells boc;
-  auto res = boc.deserialize(data);
+  auto res = boc.deserialize(data, threads_n);
   if (res.is_error()) {
     return res.move_as_error();
   }
@@ -905,12 +1173,12 @@ td::Result<Ref<Cell>> std_boc_deserialize(td::Slice data) {
   return std::move(root);
 }
 
-td::Result<std::vector<Ref<Cell>>> std_boc_deserialize_multi(td::Slice data) {
+td::Result<std::vector<Ref<Cell>>> std_boc_deserialize_multi(td::Slice data, int threads_n) {
   if (data.empty()) {
     return std::vector<Ref<Cell>>{};
   }
   BagOfCells boc;
-  auto res = boc.deserialize(data);
+  auto res = boc.deserialize(data, threads_n);
   if (res.is_error()) {
     return res.move_as_error();
   }
@@ -955,6 +1223,16 @@ td::Result<td::BufferSlice> std_boc_serialize_multi(std::vector<Ref<Cell>> roots
   return boc.serialize_to_slice(mode);
 }
 
+td::Status std_boc_serialize_to_file(Ref<Cell> root, td::FileFd& fd, int mode) {
+  if (root.is_null()) {
+    return td::Status::Error("cannot serialize a null cell reference into a bag of cells");
+  }
+  BagOfCells boc;
+  boc.add_root(std::move(root));
+  TRY_STATUS(boc.import_cells());
+  return boc.serialize_to_file(fd, mode);
+}
+
 /*
  * 
  *  Cell storage statistics
@@ -1,18 +1,22 @@
 #pragma once
+#include <functional>
 #include <set>
 #include "vm/cells.h"
 #include "td/utils/Status.h"
 #include "td/utils/buffer.h"
+#include "td/utils/port/FileFd.h"
 #include "absl/container/flat_hash_map.h"
 
 namespace vm {
 using td::Ref;
 
-td::Result<Ref<Cell>> std_boc_deserialize(td::Slice data);
+td::Result<Ref<Cell>> std_boc_deserialize(td::Slice data, int threads_n = 1);
 td::Result<td::BufferSlice> std_boc_serialize(Ref<Cell> root, int mode = 0);
 
-td::Result<std::vector<Ref<Cell>>> std_boc_deserialize_multi(td::Slice data);
+td::Result<std::vector<Ref<Cell>>> std_boc_deserialize_multi(td::Slice data, int threads_n = 1);
 td::Result<td::BufferSlice> std_boc_serialize_multi(std::vector<Ref<Cell>> root, int mode = 0);
+// writes the bag of cells to fd without keeping the whole serialization in memory
+td::Status std_boc_serialize_to_file(Ref<Cell> root, td::FileFd& fd, int mode = 0);
 
 class NewCellStorageStat {
  public:
@@ -104,7 +108,9 @@ struct CellSerializationInfo {
   td::Status init(td::uint8 d1, td::uint8 d2, int ref_byte_size);
   td::Result<int> get_bits(td::Slice cell) const;
 
-  td::Result<Ref<DataCell>> create_data_cell(td::Slice data, td::Span<Ref<Cell>> refs) const;
+  // the hash of the new cell may be deferred to `batch` unless it has to be checked against the serialization
+  td::Result<Ref<DataCell>> create_data_cell(td::Slice data, td::Span<Ref<Cell>> refs,
+                                             DataCell::HashBatch* batch = nullptr) const;
 };
 
 class BagOfCells {
@@ -112,6 +118,7 @@ class BagOfCells {
   enum { hash_bytes = vm::Cell::hash_bytes };
   enum Mode { WithIndex = 1, WithCRC32C = 2, WithTopHash = 4, WithIntHashes = 8, WithCacheBits = 16, max = 31 };
   enum { max_cell_whs = 64 };
+  enum : std::size_t { default_stream_buffer_size = 1 << 20 };
   using Hash = Cell::Hash;
   struct Info {
     enum : td::uint32 { boc_idx = 0x68ff65f3, boc_idx_crc32c = 0xacc3a728, boc_generic = 0xb5ee9c72 };
@@ -156,8 +163,6 @@ class BagOfCells {
   int max_depth{1024};
   Info info;
   unsigned long long data_bytes{0};
-  unsigned char* store_ptr{nullptr};
-  unsigned char* store_end{nullptr};
   //std::map<hash_t, int> cells;
   absl::flat_hash_map<Hash, int> cells;
   struct CellInfo {
@@ -208,9 +213,18 @@ class BagOfCells {
   std::string serialize_to_string(int mode = 0);
   td::Result<td::BufferSlice> serialize_to_slice(int mode = 0);
   std::size_t serialize_to(unsigned char* buffer, std::size_t buff_size, int mode = 0);
+  // streaming serialization: the result is passed to `write` in pieces of at most buffer_size bytes,
+  // so that memory usage does not grow with the size of the serialization
+  td::Status serialize_to_stream(const std::function<td::Status(td::Slice)>& write, int mode = 0,
+                                 std::size_t buffer_size = default_stream_buffer_size);
+  td::Status serialize_to_file(td::FileFd& fd, int mode = 0, std::size_t buffer_size = default_stream_buffer_size);
+  td::Status serialize_to_buffer(td::ChainBufferWriter& output, int mode = 0,
+                                 std::size_t buffer_size = default_stream_buffer_size);
   std::string extract_string() const;
 
-  td::Result<long long> deserialize(const td::Slice& data);
+  // with threads_n > 1 independent cells are created (and hashed) on threads_n threads,
+  // and the CRC32C of a large bag is computed in threads_n parts
+  td::Result<long long> deserialize(const td::Slice& data, int threads_n = 1);
   td::Result<long long> deserialize(const unsigned char* buffer, std::size_t buff_size) {
     return deserialize(td::Slice{buffer, buff_size});
   }
@@ -235,23 +249,8 @@ class BagOfCells {
     cell_list_.clear();
   }
   std::size_t compute_sizes(int mode, int& r_size, int& o_size);
-  void init_store(unsigned char* from, unsigned char* to) {
-    store_ptr = from;
-    store_end = to;
-  }
-  void store_chk() const {
-    DCHECK(store_ptr <= store_end);
-  }
-  bool store_empty() const {
-    return store_ptr == store_end;
-  }
-  void store_uint(unsigned long long value, unsigned bytes);
-  void store_ref(unsigned long long value) {
-    store_uint(value, info.ref_byte_size);
-  }
-  void store_offset(unsigned long long value) {
-    store_uint(value, info.offset_byte_size);
-  }
+  template <class WriterT>
+  std::size_t serialize_to_impl(WriterT& writer, int mode);
   void reorder_cells();
   int revisit(int cell_idx, int force = 0);
   unsigned long long get_idx_entry_raw(int index);
@@ -259,7 +258,10 @@ class BagOfCells {
   bool get_cache_entry(int index);
   td::Result<td::Slice> get_cell_slice(int index, td::Slice data);
   td::Result<td::Ref<vm::DataCell>> deserialize_cell(int index, td::Slice data, td::Span<td::Ref<DataCell>> cells,
-                                                     std::vector<td::uint8>* cell_should_cache);
+                                                     std::vector<td::uint8>* cell_should_cache,
+                                                     DataCell::HashBatch* batch = nullptr);
+  td::Status deserialize_cells_parallel(td::Slice cells_slice, td::MutableSpan<td::Ref<DataCell>> cell_list,
+                                        std::vector<td::uint8>* cell_should_cache, int threads_n);
 };
 
 }  // namespace vm
@@ -331,6 +331,24 @@ int store_int_common_fail(int code, Stack& stack, Ref<CellBuilder> builder, td::
 
 int exec_store_int_common(Stack& stack, unsigned bits, unsigned args) {
   bool sgnd = !(args & 1);
+  int x_idx = (args & 2) ? 0 : 1;
+  if (bits <= 64 && stack[x_idx].is_smallint() && stack[1 - x_idx].type() == StackEntry::t_builder) {
+    // an integer kept inline by the stack, no BigInt256 needed
+    long long x = stack[x_idx].as_smallint();
+    // a zero-width signed field holds only 0
+    bool fits = sgnd ? (bits == 0 ? x == 0 : bits == 64 || (x >= -(1LL << (bits - 1)) && x < (1LL << (bits - 1))))
+                     : (x >= 0 && (bits >= 63 || x < (1LL << bits)));
+    if (fits && stack[1 - x_idx].as_builder()->can_extend_by(bits)) {
+      auto builder = std::move(stack[1 - x_idx]).as_builder();
+      stack.pop_many(2);
+      builder.write().store_long(x, bits);
+      stack.push_builder(std::move(builder));
+      if (args & 4) {
+        stack.push_smallint(0);
+      }
+      return 0;
+    }
+  }
   Ref<CellBuilder> builder;
   td::RefInt256 x;
   if (!(args & 2)) {
@@ -863,7 +881,15 @@ int exec_load_int_common(Stack& stack, unsigned bits, unsigned mode) {
     return 0;
   }
   bool sgnd = !(mode & 1);
-  if (mode & 2) {
+  if (bits <= (sgnd ? 64u : 63u)) {
+    // fits into 64 bits, kept inline by the stack
+    if (mode & 2) {
+      stack.push_smallint(sgnd ? cs->prefetch_long(bits) : static_cast<long long>(cs->prefetch_ulong(bits)));
+    } else {
+      stack.push_smallint(sgnd ? cs.write().fetch_long(bits) : static_cast<long long>(cs.write().fetch_ulong(bits)));
+      stack.push_cellslice(std::move(cs));
+    }
+  } else if (mode & 2) {
     stack.push_int(cs->prefetch_int256(bits, sgnd));
   } else {
     stack.push_int(cs.write().fetch_int256(bits, sgnd));
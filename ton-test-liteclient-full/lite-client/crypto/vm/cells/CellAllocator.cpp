@@ -0,0 +1,215 @@
+#include "vm/cells/CellAllocator.h"
+
+#include "td/utils/logging.h"
+#include "td/utils/port/thread_local.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace vm {
+namespace detail {
+namespace {
+constexpr size_t granularity = 8;
+constexpr size_t class_count = CellAllocator::max_size / granularity;
+// free blocks move between a thread and the depot in batches of this size
+constexpr size_t batch_size = 256;
+constexpr size_t slab_size = 64 << 10;
+
+size_t get_size_class(size_t size) {
+  CHECK(size != 0 && size <= CellAllocator::max_size);
+  return (size - 1) / granularity;
+}
+size_t get_block_size(size_t size_class) {
+  return (size_class + 1) * granularity;
+}
+
+struct FreeBlock {
+  FreeBlock *next;
+};
+
+struct FreeList {
+  FreeBlock *head{nullptr};
+  size_t size{0};
+
+  void push(void *ptr) {
+    auto *block = static_cast<FreeBlock *>(ptr);
+    block->next = head;
+    head = block;
+    size++;
+  }
+  void *pop() {
+    DCHECK(size != 0);
+    auto *block = head;
+    head = block->next;
+    size--;
+    return block;
+  }
+  // detaches the first n blocks
+  FreeList split(size_t n) {
+    DCHECK(n != 0 && n <= size);
+    FreeList res;
+    res.head = head;
+    res.size = n;
+    auto *last = head;
+    for (size_t i = 1; i < n; i++) {
+      last = last->next;
+    }
+    head = last->next;
+    last->next = nullptr;
+    size -= n;
+    return res;
+  }
+};
+
+class Depot {
+ public:
+  void put(size_t size_class, FreeList list) {
+    if (list.size == 0) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    batches_[size_class].push_back(list);
+  }
+  FreeList take(size_t size_class) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto &batches = batches_[size_class];
+    if (batches.empty()) {
+      return {};
+    }
+    auto res = batches.back();
+    batches.pop_back();
+    return res;
+  }
+  char *new_slab() {
+    auto *slab = static_cast<char *>(std::malloc(slab_size));
+    if (slab == nullptr) {
+      throw std::bad_alloc();
+    }
+    slabs_.fetch_add(1, std::memory_order_relaxed);
+    return slab;
+  }
+  CellAllocator::Stats get_stats() const {
+    CellAllocator::Stats res;
+    res.slabs = slabs_.load(std::memory_order_relaxed);
+    res.slab_bytes = res.slabs * slab_size;
+    return res;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<FreeList> batches_[class_count];
+  std::atomic<td::uint64> slabs_{0};
+};
+
+Depot &get_depot() {
+  // never destroyed: cells may still be freed by destructors of other static objects
+  static Depot *depot = new Depot();
+  return *depot;
+}
+
+// set when the thread locals of the thread are destroyed, they can't be created again
+TD_THREAD_LOCAL bool thread_cache_destroyed;  // static zero-initialized
+
+class ThreadCache {
+ public:
+  ThreadCache() = default;
+  ThreadCache(const ThreadCache &other) = delete;
+  ThreadCache &operator=(const ThreadCache &other) = delete;
+  ~ThreadCache() {
+    thread_cache_destroyed = true;
+    auto &depot = get_depot();
+    for (size_t size_class = 0; size_class < class_count; size_class++) {
+      auto &cache = classes_[size_class];
+      auto block_size = get_block_size(size_class);
+      for (; cache.slab_begin + block_size <= cache.slab_end; cache.slab_begin += block_size) {
+        cache.free.push(cache.slab_begin);
+      }
+      while (cache.free.size != 0) {
+        depot.put(size_class, cache.free.split(std::min(batch_size, cache.free.size)));
+      }
+    }
+  }
+
+  void *allocate(size_t size_class) {
+    auto &cache = classes_[size_class];
+    if (cache.free.size != 0) {
+      return cache.free.pop();
+    }
+    auto block_size = get_block_size(size_class);
+    if (cache.slab_begin + block_size > cache.slab_end) {
+      cache.free = get_depot().take(size_class);
+      if (cache.free.size != 0) {
+        return cache.free.pop();
+      }
+      cache.slab_begin = get_depot().new_slab();
+      cache.slab_end = cache.slab_begin + slab_size;
+    }
+    auto *res = cache.slab_begin;
+    cache.slab_begin += block_size;
+    return res;
+  }
+
+  void deallocate(void *ptr, size_t size_class) {
+    auto &free = classes_[size_class].free;
+    free.push(ptr);
+    if (free.size >= 2 * batch_size) {
+      get_depot().put(size_class, free.split(batch_size));
+    }
+  }
+
+ private:
+  struct SizeClass {
+    FreeList free;
+    // the part of the last slab not handed out yet
+    char *slab_begin{nullptr};
+    char *slab_end{nullptr};
+  };
+  SizeClass classes_[class_count];
+};
+
+ThreadCache *get_thread_cache() {
+  if (thread_cache_destroyed) {
+    return nullptr;
+  }
+  // a C++ thread_local rather than td::init_thread_local, so that the cache returns its blocks to the depot
+  // when any thread exits, not only the threads created by td
+  static thread_local ThreadCache thread_cache;
+  return &thread_cache;
+}
+}  // namespace
+
+void *CellAllocator::allocate(size_t size) {
+  auto size_class = get_size_class(size);
+  auto *cache = get_thread_cache();
+  if (cache == nullptr) {
+    // the block will join the pool when it is freed
+    auto *res = std::malloc(get_block_size(size_class));
+    if (res == nullptr) {
+      throw std::bad_alloc();
+    }
+    return res;
+  }
+  return cache->allocate(size_class);
+}
+
+void CellAllocator::deallocate(void *ptr, size_t size) {
+  auto size_class = get_size_class(size);
+  auto *cache = get_thread_cache();
+  if (cache == nullptr) {
+    FreeList list;
+    list.push(ptr);
+    get_depot().put(size_class, list);
+    return;
+  }
+  cache->deallocate(ptr, size_class);
+}
+
+CellAllocator::Stats CellAllocator::get_stats() {
+  return get_depot().get_stats();
+}
+}  // namespace detail
+}  // namespace vm
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "td/utils/common.h"
+
+namespace vm {
+namespace detail {
+// Size-classed pool for cells allocated together with their storage (see CellWithArrayStorage).
+// Blocks are cut from large slabs, so bulk loading a bag of cells makes a few thousand allocations instead of millions.
+// Every thread keeps free lists of its own and exchanges batches of free blocks with a shared depot,
+// so a cell may be freed by any thread. When a thread exits, its free lists and the unused rest of its slabs
+// go back to the depot for other threads to reuse.
+// Slabs are never returned to the system: the memory of the peak number of live cells stays with the process
+// and is reused for new cells.
+class CellAllocator {
+ public:
+  static constexpr size_t max_size = 512;
+
+  static void *allocate(size_t size);
+  static void deallocate(void *ptr, size_t size);
+
+  struct Stats {
+    td::uint64 slabs{0};
+    td::uint64 slab_bytes{0};
+  };
+  static Stats get_stats();
+};
+}  // namespace detail
+}  // namespace vm
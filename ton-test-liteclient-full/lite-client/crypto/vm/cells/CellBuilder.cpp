@@ -43,13 +43,12 @@ Ref<DataCell> CellBuilder::finalize_copy(bool special) const {
   return res.move_as_ok();
 }
 
-Ref<DataCell> CellBuilder::finalize(bool special) {
+Ref<DataCell> CellBuilder::finalize(bool special, DataCell::HashBatch* batch) {
   auto* vm_state_interface = VmStateInterface::get();
   if (vm_state_interface) {
     vm_state_interface->register_cell_create();
   }
-  auto res = DataCell::create(data, size(), td::mutable_span(refs.data(), size_refs()), special);
-  bits = refs_cnt = 0;
+  auto res = finalize_nothrow(special, batch);
   if (res.is_error()) {
     LOG(ERROR) << res.error();
     throw CellWriteError{};
@@ -58,6 +57,12 @@ Ref<DataCell> CellBuilder::finalize(bool special) {
   return res.move_as_ok();
 }
 
+td::Result<Ref<DataCell>> CellBuilder::finalize_nothrow(bool special, DataCell::HashBatch* batch) {
+  auto res = DataCell::create(data, size(), td::mutable_span(refs.data(), size_refs()), special, batch);
+  bits = refs_cnt = 0;
+  return res;
+}
+
 Ref<Cell> CellBuilder::create_pruned_branch(Ref<Cell> cell, td::uint32 new_level, td::uint32 virt_level) {
   if (cell->is_loaded() && cell->get_level() <= virt_level && cell->get_virtualization() == 0) {
     CellSlice cs(NoVm{}, cell);
@@ -139,7 +139,8 @@ class CellBuilder : public td::CntObject {
   bool can_extend_by(std::size_t bits) const;
   bool can_extend_by(std::size_t bits, unsigned refs) const;
   Ref<DataCell> finalize_copy(bool special = false) const;
-  Ref<DataCell> finalize(bool special = false);
+  Ref<DataCell> finalize(bool special = false, DataCell::HashBatch* batch = nullptr);
+  td::Result<Ref<DataCell>> finalize_nothrow(bool special = false, DataCell::HashBatch* batch = nullptr);
   bool finalize_to(Ref<Cell>& res, bool special = false) {
     return (res = finalize(special)).not_null();
   }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "vm/cells/CellAllocator.h"
+
 namespace vm {
 namespace detail {
 template <class CellT, size_t Size = 0>
@@ -11,9 +13,16 @@ class CellWithArrayStorage : public CellT {
   ~CellWithArrayStorage() {
     CellT::destroy_storage(get_storage());
   }
+  static void* operator new(size_t size) {
+    return CellAllocator::allocate(size);
+  }
+  static void operator delete(void* ptr, size_t size) {
+    CellAllocator::deallocate(ptr, size);
+  }
   template <class... ArgsT>
   static std::unique_ptr<CellT> create(size_t storage_size, ArgsT&&... args) {
     static_assert(CellT::max_storage_size <= 40 * 8, "");
+    static_assert(sizeof(CellWithArrayStorage<CellT, 40 * 8>) <= CellAllocator::max_size, "");
     //size = 128 + 32 + 8;
     auto size = (storage_size + 7) / 8;
 #define CASE(size) \
@@ -1,14 +1,15 @@
 #include "vm/cells/DataCell.h"
 
-#include "openssl/digest.h"
-
 #include "td/utils/ScopeGuard.h"
+#include "td/utils/Sha256Batch.h"
 
 #include "vm/cells/CellWithStorage.h"
 
+#include <cstring>
+
 namespace vm {
 std::unique_ptr<DataCell> DataCell::create_empty_data_cell(Info info) {
-  return detail::CellWithUniquePtrStorage<DataCell>::create(info.get_storage_size(), info);
+  return detail::CellWithArrayStorage<DataCell>::create(info.get_storage_size(), info);
 }
 
 td::ThreadSafeCounter DataCell::total_data_cells;
@@ -27,13 +28,13 @@ void DataCell::destroy_storage(char* storage) {
 }
 
 td::Result<Ref<DataCell>> DataCell::create(td::ConstBitPtr data, unsigned bits, td::Span<Ref<Cell>> refs,
-                                           bool special) {
+                                           bool special, HashBatch* batch) {
   std::array<Ref<Cell>, max_refs> copied_refs;
   CHECK(refs.size() <= copied_refs.size());
   for (size_t i = 0; i < refs.size(); i++) {
     copied_refs[i] = refs[i];
   }
-  return create(std::move(data), bits, td::MutableSpan<Ref<Cell>>(copied_refs.data(), refs.size()), special);
+  return create(std::move(data), bits, td::MutableSpan<Ref<Cell>>(copied_refs.data(), refs.size()), special, batch);
 }
 
 DataCell::SpecialType DataCell::special_type() const {
@@ -44,12 +45,20 @@ DataCell::SpecialType DataCell::special_type() const {
 }
 
 td::Result<Ref<DataCell>> DataCell::create(td::ConstBitPtr data, unsigned bits, td::MutableSpan<Ref<Cell>> refs,
-                                           bool special) {
+                                           bool special, HashBatch* batch) {
   for (auto& ref : refs) {
     if (ref.is_null()) {
       return td::Status::Error("Has null cell reference");
     }
   }
+  if (batch != nullptr) {
+    for (auto& ref : refs) {
+      if (batch->is_pending(ref.get())) {
+        batch->flush();
+        break;
+      }
+    }
+  }
 
   SpecialType type = SpecialType::Ordinary;
   if (special) {
@@ -197,6 +206,7 @@ td::Result<Ref<DataCell>> DataCell::create(td::ConstBitPtr data, unsigned bits,
   // NB: be careful with special cells
   auto total_hash_count = level_mask.get_hashes_count();
   auto hash_i_offset = total_hash_count - hash_count;
+  size_t deferred_repr_size = 0;
   for (td::uint32 level_i = 0, hash_i = 0, level = level_mask.get_level(); level_i <= level; level_i++) {
     if (!level_mask.is_significant(level_i)) {
       continue;
@@ -207,26 +217,30 @@ td::Result<Ref<DataCell>> DataCell::create(td::ConstBitPtr data, unsigned bits,
     if (hash_i < hash_i_offset) {
       continue;
     }
-    unsigned char tmp[2];
-    tmp[0] = info.d1(level_mask.apply(level_i));
-    tmp[1] = info.d2();
+    auto dest_i = hash_i - hash_i_offset;
 
-    static TD_THREAD_LOCAL digest::SHA256* hasher;
-    td::init_thread_local<digest::SHA256>(hasher);
-    hasher->reset();
+    // the representation is hashed at once, or later together with other cells if there is a batch
+    bool deferred = batch != nullptr && hash_count == 1;
+    unsigned char repr_buf[HashBatch::max_repr_size];
+    unsigned char* repr = deferred ? batch->prepare(&hashes_ptr[dest_i]) : repr_buf;
+    size_t repr_size = 0;
+    auto append = [&](td::Slice slice) {
+      std::memcpy(repr + repr_size, slice.data(), slice.size());
+      repr_size += slice.size();
+    };
 
-    hasher->feed(td::Slice(tmp, 2));
+    repr[0] = info.d1(level_mask.apply(level_i));
+    repr[1] = info.d2();
+    repr_size = 2;
 
     if (hash_i == hash_i_offset) {
       DCHECK(level_i == 0 || type == SpecialType::PrunnedBranch);
-      hasher->feed(td::Slice(data_ptr, (bits + 7) >> 3));
+      append(td::Slice(data_ptr, (bits + 7) >> 3));
     } else {
       DCHECK(level_i != 0 && type != SpecialType::PrunnedBranch);
-      hasher->feed(hashes_ptr[hash_i - hash_i_offset - 1].as_slice());
+      append(hashes_ptr[hash_i - hash_i_offset - 1].as_slice());
     }
 
-    auto dest_i = hash_i - hash_i_offset;
-
     // calc depth
     td::uint16 depth = 0;
     for (int i = 0; i < info.refs_count_; i++) {
@@ -240,7 +254,7 @@ td::Result<Ref<DataCell>> DataCell::create(td::ConstBitPtr data, unsigned bits,
       // add depth into hash
       td::uint8 child_depth_buf[depth_bytes];
       store_depth(child_depth_buf, child_depth);
-      hasher->feed(td::Slice(child_depth_buf, depth_bytes));
+      append(td::Slice(child_depth_buf, depth_bytes));
 
       depth = std::max(depth, child_depth);
     }
@@ -255,16 +269,67 @@ td::Result<Ref<DataCell>> DataCell::create(td::ConstBitPtr data, unsigned bits,
     // children hash
     for (int i = 0; i < info.refs_count_; i++) {
       if (type == SpecialType::MerkleProof || type == SpecialType::MerkleUpdate) {
-        hasher->feed(refs_ptr[i]->get_hash(level_i + 1).as_slice());
+        append(refs_ptr[i]->get_hash(level_i + 1).as_slice());
       } else {
-        hasher->feed(refs_ptr[i]->get_hash(level_i).as_slice());
+        append(refs_ptr[i]->get_hash(level_i).as_slice());
       }
     }
-    auto extracted_size = hasher->extract(hashes_ptr[dest_i].as_slice());
-    DCHECK(extracted_size == hash_bytes);
+    if (deferred) {
+      // committed once the cell exists, see below
+      deferred_repr_size = repr_size;
+    } else {
+      td::Slice input(repr, repr_size);
+      td::MutableSlice output = hashes_ptr[dest_i].as_slice();
+      td::sha256_batch(td::Span<td::Slice>(&input, 1), td::Span<td::MutableSlice>(&output, 1));
+    }
+  }
+
+  auto res = Ref<DataCell>(data_cell.release(), Ref<DataCell>::acquire_t{});
+  if (deferred_repr_size != 0) {
+    batch->commit(res, deferred_repr_size);
+  }
+  return res;
+}
+
+bool DataCell::HashBatch::is_pending(const Cell* cell) const {
+  for (size_t i = 0; i < size_; i++) {
+    if (entries_[i].cell.get() == cell) {
+      return true;
+    }
   }
+  return false;
+}
 
-  return Ref<DataCell>(data_cell.release(), Ref<DataCell>::acquire_t{});
+unsigned char* DataCell::HashBatch::prepare(Hash* hash) {
+  if (size_ == max_size) {
+    flush();
+  }
+  auto& entry = entries_[size_];
+  entry.hash = hash;
+  return entry.repr.data();
+}
+
+void DataCell::HashBatch::commit(Ref<Cell> cell, size_t size) {
+  auto& entry = entries_[size_++];
+  entry.cell = std::move(cell);
+  entry.size = size;
+}
+
+void DataCell::HashBatch::flush() {
+  if (size_ == 0) {
+    return;
+  }
+  std::array<td::Slice, max_size> inputs;
+  std::array<td::MutableSlice, max_size> outputs;
+  for (size_t i = 0; i < size_; i++) {
+    inputs[i] = td::Slice(entries_[i].repr.data(), entries_[i].size);
+    outputs[i] = entries_[i].hash->as_slice();
+  }
+  td::sha256_batch(td::Span<td::Slice>(inputs.data(), size_), td::Span<td::MutableSlice>(outputs.data(), size_));
+  for (size_t i = 0; i < size_; i++) {
+    entries_[i].cell.clear();
+  }
+  size_ = 0;
 }
 
 const DataCell::Hash DataCell::do_get_hash(td::uint32 level) const {
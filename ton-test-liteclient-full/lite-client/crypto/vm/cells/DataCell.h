@@ -5,10 +5,44 @@
 
 #include "td/utils/ThreadSafeCounter.h"
 
+#include <array>
+
 namespace vm {
 
 class DataCell : public Cell {
  public:
+  // Defers the representation hashes of new cells so that they are computed together by td::sha256_batch.
+  // Only cells with a single hash are deferred. Until the batch is flushed the hash of such a cell is undefined;
+  // creating a cell that refers to a pending one flushes the batch first. The batch keeps pending cells alive
+  // until the flush, so a caller may drop a new cell (e.g. one failing validation) without flushing.
+  class HashBatch {
+   public:
+    HashBatch() = default;
+    HashBatch(const HashBatch& other) = delete;
+    HashBatch& operator=(const HashBatch& other) = delete;
+    ~HashBatch() {
+      flush();
+    }
+    void flush();
+
+   private:
+    friend class DataCell;
+    static constexpr size_t max_size = 16;
+    static constexpr size_t max_repr_size = 2 + max_bytes + max_refs * (depth_bytes + hash_bytes);
+    struct Entry {
+      Ref<Cell> cell;
+      Hash* hash;
+      size_t size;
+      std::array<unsigned char, max_repr_size> repr;
+    };
+    std::array<Entry, max_size> entries_;
+    size_t size_{0};
+
+    bool is_pending(const Cell* cell) const;
+    unsigned char* prepare(Hash* hash);
+    void commit(Ref<Cell> cell, size_t size);
+  };
+
   DataCell(const DataCell& other) = delete;
   ~DataCell() override;
 
@@ -180,9 +214,10 @@ class DataCell : public Cell {
   td::uint16 do_get_depth(td::uint32 level) const override;
 
   friend class CellBuilder;
-  static td::Result<Ref<DataCell>> create(td::ConstBitPtr data, unsigned bits, td::Span<Ref<Cell>> refs, bool special);
+  static td::Result<Ref<DataCell>> create(td::ConstBitPtr data, unsigned bits, td::Span<Ref<Cell>> refs, bool special,
+                                          HashBatch* batch = nullptr);
   static td::Result<Ref<DataCell>> create(td::ConstBitPtr data, unsigned bits, td::MutableSpan<Ref<Cell>> refs,
-                                          bool special);
+                                          bool special, HashBatch* batch = nullptr);
 };
 
 std::ostream& operator<<(std::ostream& os, const DataCell& c);
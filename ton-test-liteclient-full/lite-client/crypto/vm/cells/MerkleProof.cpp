@@ -20,7 +20,9 @@ class MerkleProofImpl {
       dfs_usage_tree(cell, usage_tree_->root_id());
       is_prunned_ = [this](const Ref<Cell> &cell) { return visited_cells_.count(cell->get_hash()) == 0; };
     }
-    return dfs(cell, cell->get_level());
+    auto res = dfs(cell, cell->get_level());
+    hash_batch_.flush();
+    return res;
   }
 
  private:
@@ -29,6 +31,8 @@ class MerkleProofImpl {
   absl::flat_hash_set<Cell::Hash> visited_cells_;
   CellUsageTree *usage_tree_{nullptr};
   MerkleProof::IsPrunnedFunction is_prunned_;
+  // the keys of cells_ are hashes of the original cells, so new cells are not hashed until their parents need it
+  DataCell::HashBatch hash_batch_;
 
   void dfs_usage_tree(Ref<Cell> cell, CellUsageTree::NodeId node_id) {
     if (!usage_tree_->is_loaded(node_id)) {
@@ -65,7 +69,7 @@ class MerkleProofImpl {
     for (unsigned i = 0; i < cs.size_refs(); i++) {
       cb.store_ref(dfs(cs.prefetch_ref(i), children_merkle_depth));
     }
-    auto res = cb.finalize(cs.is_special());
+    auto res = cb.finalize(cs.is_special(), &hash_batch_);
     CHECK(res.not_null());
     cells_.emplace(key, res);
     return res;
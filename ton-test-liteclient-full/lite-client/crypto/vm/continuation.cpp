@@ -3,6 +3,14 @@
 
 #include "vm/log.h"
 
+#include "td/utils/port/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+
 namespace vm {
 
 int Continuation::jump_w(VmState* st) & {
@@ -262,7 +270,9 @@ void VmState::init_cregs(bool same_c3, bool push_0) {
     cr.set_c3(Ref<ExcQuitCont>{true});
   }
   if (cr.d[0].is_null() || cr.d[1].is_null() || cr.d[2].is_null()) {
-    auto empty_cell = CellBuilder{}.finalize();
+    if (empty_cell.is_null()) {
+      empty_cell = CellBuilder{}.finalize();
+    }
     for (int i = 0; i < ControlRegs::dreg_num; i++) {
       if (cr.d[i].is_null()) {
         cr.d[i] = empty_cell;
@@ -326,6 +336,17 @@ VmState::VmState(Ref<Cell> code_cell, Ref<Stack> _stack, const GasLimits& gas, i
   init_cregs(flags & 1, flags & 2);
 }
 
+void VmState::reset(Ref<CellSlice> _code, Ref<Stack> _stack, const GasLimits& _gas, int flags, Ref<Cell> _data) {
+  code = std::move(_code);
+  stack = std::move(_stack);
+  cr = ControlRegs{};
+  steps = 0;
+  gas = _gas;
+  ensure_throw(init_cp(0));
+  set_c4(std::move(_data));
+  init_cregs(flags & 1, flags & 2);
+}
+
 bool VmState::init_cp(int new_cp) {
   const DispatchTable* dt = DispatchTable::get_table(new_cp);
   if (dt) {
@@ -730,6 +751,70 @@ int run_vm_code(Ref<CellSlice> code, Stack& stack, int flags, Ref<Cell>* data_pt
   return res;
 }
 
+void run_vm_code_batch(std::vector<VmBatchCall>& calls, unsigned threads_n, VmLog log) {
+  if (threads_n == 0) {
+    threads_n = std::max(td::thread::hardware_concurrency(), 1u);
+  }
+  // small enough to even out calls of different length, large enough not to fight over next_call
+  std::size_t chunk = std::min<std::size_t>(std::max<std::size_t>(calls.size() / (threads_n * 16), 1), 64);
+  threads_n = static_cast<unsigned>(std::min<std::size_t>(threads_n, (calls.size() + chunk - 1) / chunk));
+  std::atomic<std::size_t> next_call{0};
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  auto run_calls = [&] {
+    std::unique_ptr<VmState> vm;
+    while (true) {
+      auto begin = next_call.fetch_add(chunk);
+      if (begin >= calls.size()) {
+        break;
+      }
+      auto end = std::min(begin + chunk, calls.size());
+      for (auto i = begin; i < end; i++) {
+        auto& call = calls[i];
+        if (!vm) {
+          vm = std::make_unique<VmState>(call.code, std::move(call.stack), call.gas, call.flags, call.data, log);
+        } else {
+          vm->reset(call.code, std::move(call.stack), call.gas, call.flags, call.data);
+        }
+        int res;
+        try {
+          res = vm->run();
+        } catch (const VmVirtError& err) {
+          // a pruned branch of the data or the code was loaded, the call ends as on an unhandled VmError
+          res = ~err.get_errno();
+        } catch (...) {
+          // e.g. std::bad_alloc; the other threads stop taking calls, and it is rethrown after they are joined
+          std::lock_guard<std::mutex> guard(error_mutex);
+          if (!error) {
+            error = std::current_exception();
+          }
+          next_call = calls.size();
+          return;
+        }
+        call.stack = vm->get_stack_ref();
+        if (res == -1) {
+          call.data = vm->get_c4();
+        }
+        call.gas = vm->get_gas_limits();
+        call.steps = vm->get_steps_count();
+        call.exit_code = ~res;
+      }
+    }
+  };
+
+  std::vector<td::thread> threads(threads_n > 1 ? threads_n - 1 : 0);
+  for (auto& thread : threads) {
+    thread = td::thread(run_calls);
+  }
+  run_calls();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
 // may throw a dictionary exception; returns nullptr if library is not found in context
 Ref<vm::Cell> VmState::load_library(td::ConstBitPtr hash) {
   return {};
@@ -346,6 +346,8 @@ class VmState final : public VmStateInterface {
   VmLog log;
   GasLimits gas;
   std::vector<Ref<Cell>> libraries;
+  // the initial value of c4..c6, kept for reset
+  Ref<Cell> empty_cell;
   //TODO: Dictionary library;?
 
  public:
@@ -357,6 +359,8 @@ class VmState final : public VmStateInterface {
           VmLog log = {});
   VmState(Ref<Cell> _code_cell, Ref<Stack> _stack, const GasLimits& _gas, int flags = 0, Ref<Cell> _data = {},
           std::vector<Ref<Cell>> _libraries = {}, VmLog log = {});
+  // prepares a used state for running another code; the log and the libraries are kept
+  void reset(Ref<CellSlice> _code, Ref<Stack> _stack, const GasLimits& _gas, int flags = 0, Ref<Cell> _data = {});
   bool set_gas_limits(long long _max, long long _limit, long long _credit = 0);
   bool final_gas_ok() const {
     return gas.final_ok();
@@ -504,6 +508,23 @@ int run_vm_code(Ref<CellSlice> _code, Ref<Stack>& _stack, int flags = 0, Ref<Cel
 int run_vm_code(Ref<CellSlice> _code, Stack& _stack, int flags = 0, Ref<Cell>* data_ptr = 0, VmLog log = {},
                 long long* steps = nullptr, GasLimits* gas_limits = nullptr);
 
+// one call of run_vm_code_batch; stack, data and gas are replaced by the results as by run_vm_code
+struct VmBatchCall {
+  Ref<CellSlice> code;
+  Ref<Stack> stack;
+  Ref<Cell> data;
+  GasLimits gas;
+  int flags{0};
+  int exit_code{0};
+  long long steps{0};
+};
+
+// Runs independent calls (e.g. one get-method of many accounts) on threads_n threads, one per core if 0.
+// Threads take the calls in small chunks as they become free, and each of them runs all its calls in one VmState.
+// A call loading a pruned branch ends with exit code Excno::virt_err; any other exception (e.g. std::bad_alloc)
+// stops the batch and is rethrown once all threads are joined.
+void run_vm_code_batch(std::vector<VmBatchCall>& calls, unsigned threads_n = 0, VmLog log = {});
+
 ControlData* force_cdata(Ref<Continuation>& cont);
 ControlRegs* force_cregs(Ref<Continuation>& cont);
 
@@ -1,10 +1,17 @@
 #pragma once
 
+#include "td/utils/common.h"
 #include "td/utils/Slice.h"
 
-#include <set>
+#include <absl/container/node_hash_set.h>
+#include <absl/hash/hash.h>
+#include <absl/strings/string_view.h>
+
+#include <cstring>
 
 namespace vm {
+// InfoT::key() must return its hash as td::Slice or as anything with an as_slice() method (e.g. Cell::Hash).
+// Infos are stored in separate nodes, so references returned by apply() stay valid until the info is erased.
 template <class InfoT>
 class CellHashTable {
  public:
@@ -34,7 +41,7 @@ class CellHashTable {
       if (f(*it)) {
         it++;
       } else {
-        it = set_.erase(it);
+        set_.erase(it++);
       }
     }
   }
@@ -48,6 +55,41 @@ class CellHashTable {
   }
 
  private:
-  std::set<InfoT, std::less<>> set_;
+  static td::Slice as_key(td::Slice hash) {
+    return hash;
+  }
+  template <class KeyT>
+  static auto as_key(const KeyT &key) -> decltype(key.as_slice()) {
+    return key.as_slice();
+  }
+
+  struct Hash {
+    using is_transparent = void;
+    size_t operator()(td::Slice hash) const {
+      // keys are SHA-256 hashes, so their first bytes are already uniformly distributed
+      if (hash.size() < sizeof(size_t)) {
+        return absl::Hash<absl::string_view>()(absl::string_view(hash.data(), hash.size()));
+      }
+      size_t res;
+      std::memcpy(&res, hash.data(), sizeof(res));
+      return res;
+    }
+    size_t operator()(const InfoT &info) const {
+      return (*this)(as_key(info.key()));
+    }
+  };
+  struct Eq {
+    using is_transparent = void;
+    bool operator()(const InfoT &a, const InfoT &b) const {
+      return as_key(a.key()) == as_key(b.key());
+    }
+    bool operator()(const InfoT &a, td::Slice b) const {
+      return as_key(a.key()) == b;
+    }
+    bool operator()(td::Slice a, const InfoT &b) const {
+      return a == as_key(b.key());
+    }
+  };
+  absl::node_hash_set<InfoT, Hash, Eq> set_;
 };
 };  // namespace vm
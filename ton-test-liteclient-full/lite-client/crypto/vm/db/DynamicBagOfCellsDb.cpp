@@ -44,19 +44,8 @@ struct CellInfo {
   Cell::Hash key() const {
     return cell->get_hash();
   }
-  bool operator<(const CellInfo &other) const {
-    return key() < other.key();
-  }
 };
 
-bool operator<(const CellInfo &a, td::Slice b) {
-  return a.key().as_slice() < b;
-}
-
-bool operator<(td::Slice a, const CellInfo &b) {
-  return a < b.key().as_slice();
-}
-
 class DynamicBagOfCellsDbImpl : public DynamicBagOfCellsDb, private ExtCellCreator {
  public:
   DynamicBagOfCellsDbImpl() {
@@ -7,8 +7,13 @@
 
 #include "td/utils/format.h"
 #include "td/utils/crypto.h"
+#include "td/utils/filesystem.h"
+#include "td/utils/port/path.h"
 #include "td/utils/port/RwMutex.h"
-#include "td/utils/ConcurrentHashTable.h"
+
+#include <array>
+#include <atomic>
+#include <vector>
 
 namespace vm {
 //
@@ -94,25 +99,91 @@ class DataCellCacheMutex {
   absl::flat_hash_map<int, Ref<DataCell>> cells_;
 };
 
-class DataCellCacheTdlib {
+// Striped cache with CLOCK eviction. A cell index always maps to the same shard, so threads loading different cells
+// rarely wait for each other, and lookups in one shard only share its read lock. Every shard keeps at most
+// capacity / shards_n cells. A hit only sets the reference bit of the entry; the eviction hand clears the bits
+// it passes and evicts the first entry that was not used since the hand passed it last time.
+class DataCellCacheClock {
  public:
+  explicit DataCellCacheClock(size_t capacity) : shard_capacity_(td::max<size_t>(capacity / shards_n, 1)) {
+  }
   Ref<DataCell> store(int idx, Ref<DataCell> cell) {
-    return Ref<DataCell>(cells_.insert(as_key(idx), cell.get()));
+    Ref<DataCell> evicted;  // released after the lock, as it may free a whole subtree
+    auto& shard = get_shard(idx);
+    auto lock = shard.mutex.lock_write();
+    auto it = shard.index.find(idx);
+    if (it != shard.index.end()) {
+      return shard.entries[it->second].cell;
+    }
+    size_t pos = shard.entries.size();
+    if (pos < shard_capacity_) {
+      shard.entries.emplace_back();
+    } else {
+      while (shard.entries[shard.hand].referenced.exchange(false, std::memory_order_relaxed)) {
+        shard.hand = shard.hand + 1 == shard.entries.size() ? 0 : shard.hand + 1;
+      }
+      pos = shard.hand;
+      shard.hand = shard.hand + 1 == shard.entries.size() ? 0 : shard.hand + 1;
+      shard.index.erase(shard.entries[pos].idx);
+      evicted = std::move(shard.entries[pos].cell);
+    }
+    auto& entry = shard.entries[pos];
+    entry.idx = idx;
+    entry.cell = std::move(cell);
+    shard.index.emplace(idx, pos);
+    return entry.cell;
   }
   Ref<DataCell> load(int idx) {
-    return Ref<DataCell>(cells_.find(as_key(idx), nullptr));
+    auto& shard = get_shard(idx);
+    auto lock = shard.mutex.lock_read();
+    auto it = shard.index.find(idx);
+    if (it == shard.index.end()) {
+      return {};
+    }
+    auto& entry = shard.entries[it->second];
+    // hot entries are only read, so their cache lines are not bounced between the readers
+    if (!entry.referenced.load(std::memory_order_relaxed)) {
+      entry.referenced.store(true, std::memory_order_relaxed);
+    }
+    return entry.cell;
   }
-
   void clear() {
-    cells_.for_each([](auto key, auto value) { Ref<DataCell>{value}; });
+    for (auto& shard : shards_) {
+      std::vector<Entry> entries;
+      auto lock = shard.mutex.lock_write();
+      shard.index.clear();
+      shard.hand = 0;
+      std::swap(entries, shard.entries);
+    }
   }
 
  private:
-  td::ConcurrentHashMap<td::uint32, const DataCell*> cells_;
-  td::uint32 as_key(int idx) {
-    td::uint32 key = static_cast<td::uint32>(idx + 1);
-    key *= 1000000007;
-    return key;
+  static constexpr int shards_log = 6;
+  static constexpr size_t shards_n = 1 << shards_log;
+
+  struct Entry {
+    int idx{-1};
+    Ref<DataCell> cell;
+    std::atomic<bool> referenced{false};
+
+    Entry() = default;
+    // entries are moved only while the vector grows under the write lock
+    Entry(Entry&& other)
+        : idx(other.idx), cell(std::move(other.cell)), referenced(other.referenced.load(std::memory_order_relaxed)) {
+    }
+  };
+  struct Shard {
+    td::RwMutex mutex;
+    absl::flat_hash_map<int, size_t> index;
+    std::vector<Entry> entries;
+    size_t hand{0};
+    char pad[TD_CONCURRENCY_PAD];
+  };
+  size_t shard_capacity_;
+  std::array<Shard, shards_n> shards_;
+
+  Shard& get_shard(int idx) {
+    return shards_[(static_cast<td::uint32>(idx) * 0x9E3779B9u) >> (32 - shards_log)];
   }
 };
 
@@ -188,6 +259,110 @@ td::Result<std::shared_ptr<StaticBagOfCellsDb>> StaticBagOfCellsDbBaseline::crea
 //
 // Main implementation
 //
+// CRC32C of the first size bytes of the blob. The blob is read in chunks, so a large file is never copied
+// into memory as a whole; each chunk is checksummed by td::crc32c_parallel
+td::Result<td::uint32> blob_crc32c(BlobView &blob, td::uint64 size, int threads_n) {
+  constexpr td::uint64 chunk_size = 1 << 26;
+  // memory blobs return views of their own data, so the pages of this buffer are not even touched
+  td::BufferSlice buf(static_cast<size_t>(td::min(chunk_size, size)));
+  td::uint32 crc = 0;
+  for (td::uint64 offset = 0; offset < size;) {
+    TRY_RESULT(chunk, blob.view(buf.as_slice().truncate(size - offset), offset));
+    auto chunk_crc = td::crc32c_parallel(chunk, threads_n);
+    crc = offset == 0 ? chunk_crc : td::crc32c_extend(crc, chunk_crc, chunk.size());
+    offset += chunk.size();
+  }
+  return crc;
+}
+
+// Cell offsets of a bag of cells without an embedded index, kept next to it so that they are computed only once.
+// Layout: magic, key length (1 byte), key, cell count (8 bytes), data size (8 bytes), entry width (1 byte),
+// CRC32C of all the previous fields, then one big-endian entry per cell: the end of its serialization
+// in the data section times two plus the cache bit, and the CRC32C of everything before it. The key (e.g. the file hash of the bag) and the counts must match
+// the bag being opened, so a stale sidecar is rebuilt.
+struct IndexSidecar {
+  static constexpr td::uint32 magic = 0x1dc5b0c2;
+
+  std::unique_ptr<BlobView> blob;
+  td::uint64 entries_offset{0};
+  int width{0};
+
+  td::Result<td::uint64> load_entry(int idx) {
+    if (idx < 0) {
+      return 0;
+    }
+    unsigned char arr[8];
+    TRY_RESULT(view, blob->view(td::MutableSlice(arr, width), entries_offset + static_cast<td::uint64>(idx) * width));
+    if (view.size() != static_cast<size_t>(width)) {
+      return td::Status::Error("bag-of-cells index is truncated");
+    }
+    return BagOfCells::Info().read_int(view.ubegin(), width);
+  }
+
+  static td::BufferSlice serialize(td::Slice key, const BagOfCells::Info& info, const std::vector<td::uint64>& ends) {
+    CHECK(key.size() < 256);
+    int width = 1;
+    while (width < 8 && (ends.empty() ? 0 : ends.back()) >> (8 * width) != 0) {
+      width++;
+    }
+    auto header_size = 4 + 1 + key.size() + 8 + 8 + 1;
+    td::BufferSlice res(header_size + 4 + ends.size() * width + 4);
+    auto ptr = res.as_slice().ubegin();
+    BagOfCells::Info writer;
+    writer.write_int(ptr, magic, 4);
+    writer.write_int(ptr + 4, key.size(), 1);
+    td::MutableSlice(ptr + 5, key.size()).copy_from(key);
+    writer.write_int(ptr + 5 + key.size(), info.cell_count, 8);
+    writer.write_int(ptr + 13 + key.size(), info.data_size, 8);
+    writer.write_int(ptr + 21 + key.size(), width, 1);
+    writer.write_int(ptr + header_size, td::crc32c(td::Slice(ptr, header_size)), 4);
+    ptr += header_size + 4;
+    for (auto end : ends) {
+      writer.write_int(ptr, end, width);
+      ptr += width;
+    }
+    writer.write_int(ptr, td::crc32c(td::Slice(res.as_slice().ubegin(), ptr)), 4);
+    return res;
+  }
+
+  static td::Result<IndexSidecar> parse(std::unique_ptr<BlobView> blob, td::Slice key, const BagOfCells::Info& info) {
+    std::string buf(4 + 1 + 255 + 8 + 8 + 1 + 4, '\0');
+    TRY_RESULT(header, blob->view(td::MutableSlice(buf).truncate(blob->size()), 0));
+    BagOfCells::Info reader;
+    auto ptr = header.ubegin();
+    if (header.size() < 5 || reader.read_int(ptr, 4) != magic) {
+      return td::Status::Error("not a bag-of-cells index");
+    }
+    auto key_size = reader.read_int(ptr + 4, 1);
+    auto header_size = 4 + 1 + key_size + 8 + 8 + 1;
+    if (header.size() < header_size + 4) {
+      return td::Status::Error("bag-of-cells index header is truncated");
+    }
+    if (reader.read_int(ptr + header_size, 4) != td::crc32c(td::Slice(ptr, header_size))) {
+      return td::Status::Error("bag-of-cells index header CRC32C mismatch");
+    }
+    if (td::Slice(ptr + 5, key_size) != key) {
+      return td::Status::Error("bag-of-cells index belongs to another file");
+    }
+    IndexSidecar res;
+    res.width = static_cast<int>(reader.read_int(ptr + 21 + key_size, 1));
+    res.entries_offset = header_size + 4;
+    if (reader.read_int(ptr + 5 + key_size, 8) != static_cast<td::uint64>(info.cell_count) ||
+        reader.read_int(ptr + 13 + key_size, 8) != info.data_size || res.width < 1 || res.width > 8 ||
+        blob->size() != res.entries_offset + static_cast<td::uint64>(info.cell_count) * res.width + 4) {
+      return td::Status::Error("bag-of-cells index does not match the file");
+    }
+    unsigned char crc_buf[4];
+    TRY_RESULT(crc_stored, blob->view(td::MutableSlice(crc_buf, 4), blob->size() - 4));
+    TRY_RESULT(crc_computed, blob_crc32c(*blob, blob->size() - 4, 1));
+    if (crc_stored.size() != 4 || reader.read_int(crc_stored.ubegin(), 4) != crc_computed) {
+      return td::Status::Error("bag-of-cells index CRC32C mismatch");
+    }
+    res.blob = std::move(blob);
+    return res;
+  }
+};
+
 class StaticBagOfCellsDbLazyImpl : public StaticBagOfCellsDb {
  public:
   explicit StaticBagOfCellsDbLazyImpl(std::unique_ptr<BlobView> data, StaticBagOfCellsDbLazy::Options options)
@@ -227,9 +402,10 @@ class StaticBagOfCellsDbLazyImpl : public StaticBagOfCellsDb {
   std::string index_data_;
   std::atomic<int> index_i_{0};
   size_t index_offset_{0};
-  DataCellCacheMutex cells_;
+  IndexSidecar index_sidecar_;
+  DataCellCacheClock cells_{options_.cache_capacity};
+  //DataCellCacheMutex cells_;
   //DataCellCacheNoop cells_;
-  //DataCellCacheTdlib cells_;
   int next_idx_{0};
   Ref<Cell> empty_cell_;
 
@@ -317,6 +493,15 @@ class StaticBagOfCellsDbLazyImpl : public StaticBagOfCellsDb {
   td::Result<CellLocation> get_cell_location(int idx) {
     CHECK(idx >= 0);
     CHECK(idx < info_.cell_count);
+    if (index_sidecar_.blob) {
+      TRY_RESULT(from, index_sidecar_.load_entry(idx - 1));
+      TRY_RESULT(till, index_sidecar_.load_entry(idx));
+      CellLocation res;
+      res.begin = (from >> 1) + info_.data_offset;
+      res.end = (till >> 1) + info_.data_offset;
+      res.should_cache = (till & 1) != 0;
+      return res;
+    }
     TRY_STATUS(preload_index(idx));
     TRY_RESULT(from, load_idx_offset(idx - 1));
     TRY_RESULT(till, load_idx_offset(idx));
@@ -348,20 +533,90 @@ class StaticBagOfCellsDbLazyImpl : public StaticBagOfCellsDb {
       return td::Status::Error("bag-of-cell error: not enough data");
     }
     if (options_.check_crc32c && info_.has_crc32c) {
-      std::string buf(info_.total_size, '\0');
-      TRY_RESULT(data, data_->view(td::MutableSlice(buf), 0));
-      unsigned crc_computed = td::crc32c(td::Slice{data.ubegin(), data.uend() - 4});
-      unsigned crc_stored = td::as<unsigned>(data.uend() - 4);
+      TRY_RESULT(crc_computed, blob_crc32c(*data_, info_.total_size - 4, options_.check_crc32c_threads));
+      unsigned char crc_buf[4];
+      TRY_RESULT(crc_slice, data_->view(td::MutableSlice(crc_buf, 4), info_.total_size - 4));
+      unsigned crc_stored = td::as<unsigned>(crc_slice.ubegin());
       if (crc_computed != crc_stored) {
         return td::Status::Error(PSLICE()
                                  << "bag-of-cells CRC32C mismatch: expected " << td::format::as_hex(crc_computed)
                                  << ", found " << td::format::as_hex(crc_stored));
       }
     }
+    if (!info_.has_index && !options_.index_path.empty()) {
+      TRY_STATUS(open_index_sidecar());
+    }
     has_info_ = true;
     return td::Status::OK();
   }
 
+  td::Status open_index_sidecar() {
+    auto r_blob = FileMemoryMappingBlobView::create(options_.index_path);
+    if (r_blob.is_ok()) {
+      auto r_sidecar = IndexSidecar::parse(r_blob.move_as_ok(), options_.index_key, info_);
+      if (r_sidecar.is_ok()) {
+        index_sidecar_ = r_sidecar.move_as_ok();
+        return td::Status::OK();
+      }
+      LOG(INFO) << "rebuilding bag-of-cells index " << options_.index_path << ": " << r_sidecar.error();
+    }
+    TRY_RESULT(data, build_index_sidecar());
+    auto tmp_path = options_.index_path + ".tmp";
+    auto status = td::write_file(tmp_path, data.as_slice());
+    if (status.is_ok()) {
+      status = td::rename(tmp_path, options_.index_path);
+    }
+    if (status.is_error()) {
+      td::unlink(tmp_path).ignore();
+      LOG(WARNING) << "cannot save bag-of-cells index " << options_.index_path << ": " << status;
+    }
+    TRY_RESULT(sidecar, IndexSidecar::parse(BufferSliceBlobView::create(std::move(data)), options_.index_key, info_));
+    index_sidecar_ = std::move(sidecar);
+    return td::Status::OK();
+  }
+
+  // reads every cell header once; cells referenced more than once get the cache bit
+  td::Result<td::BufferSlice> build_index_sidecar() {
+    auto cell_count = static_cast<size_t>(info_.cell_count);
+    std::vector<td::uint64> ends(cell_count);
+    std::vector<td::uint8> ref_cnt(cell_count, 0);
+    std::string buf(1 << 16, '\0');
+    td::Slice chunk;
+    td::uint64 chunk_begin = 0;
+    td::uint64 offset = 0;
+    for (size_t i = 0; i < cell_count; i++) {
+      if (offset >= info_.data_size) {
+        return td::Status::Error("bag-of-cells data is truncated");
+      }
+      // a cell serialization is shorter than 1024 bytes
+      if (offset + 1024 > chunk_begin + chunk.size() && chunk_begin + chunk.size() < info_.data_size) {
+        auto size = td::min<td::uint64>(buf.size(), info_.data_size - offset);
+        TRY_RESULT(new_chunk, data_->view(td::MutableSlice(buf).truncate(size), info_.data_offset + offset));
+        chunk = new_chunk;
+        chunk_begin = offset;
+      }
+      auto cell = chunk.substr(offset - chunk_begin);
+      CellSerializationInfo cell_info;
+      TRY_STATUS(cell_info.init(cell, info_.ref_byte_size));
+      auto* ref_ptr = cell.ubegin() + cell_info.refs_offset;
+      for (int k = 0; k < cell_info.refs_cnt; k++, ref_ptr += info_.ref_byte_size) {
+        auto ref_idx = info_.read_ref(ref_ptr);
+        if (ref_idx >= cell_count || ref_idx <= i) {
+          return td::Status::Error(PSLICE() << "invalid bag-of-cells cell #" << i << " refers to cell #" << ref_idx);
+        }
+        if (ref_cnt[ref_idx] < 2) {
+          ref_cnt[ref_idx]++;
+        }
+      }
+      offset += cell_info.end_offset;
+      ends[i] = offset;
+    }
+    for (size_t i = 0; i < cell_count; i++) {
+      ends[i] = ends[i] * 2 + (ref_cnt[i] > 1);
+    }
+    return IndexSidecar::serialize(options_.index_key, info_, ends);
+  }
+
   td::Status preload_index(int idx) {
     if (info_.has_index) {
       return td::Status::OK();
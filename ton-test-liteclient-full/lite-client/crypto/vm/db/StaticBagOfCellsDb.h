@@ -33,6 +33,14 @@ class StaticBagOfCellsDbLazy {
     Options() {
     }
     bool check_crc32c{false};
+    // the checksum of a large bag is computed in parts on this many threads
+    int check_crc32c_threads{1};
+    // loaded cells kept for reuse; evicted ones are loaded again from the blob when needed
+    size_t cache_capacity{1 << 20};
+    // for bags of cells without an embedded index: where to keep their cell offsets, so that the cells are scanned
+    // only on the first open; index_key identifies the bag (e.g. by its file hash), a sidecar for another key is rebuilt
+    std::string index_path;
+    std::string index_key;
   };
   static td::Result<std::shared_ptr<StaticBagOfCellsDb>> create(std::unique_ptr<BlobView> data, Options options = {});
   static td::Result<std::shared_ptr<StaticBagOfCellsDb>> create(td::BufferSlice data, Options options = {});
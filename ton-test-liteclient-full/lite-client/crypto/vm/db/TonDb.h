@@ -115,14 +115,8 @@ class TonDbTransactionImpl {
     td::uint64 generation_{0};
     std::string hash;
     SmartContractDb smart_contract_db;
-    bool operator<(const SmartContractInfo &other) const {
-      return hash < other.hash;
-    }
-    friend bool operator<(const SmartContractInfo &info, td::Slice hash) {
-      return info.hash < hash;
-    }
-    friend bool operator<(td::Slice hash, const SmartContractInfo &info) {
-      return hash < info.hash;
+    td::Slice key() const {
+      return hash;
     }
   };
 
@@ -7,6 +7,8 @@
 
 #include "td/utils/bits.h"
 
+#include <algorithm>
+
 namespace vm {
 
 /*
@@ -445,6 +447,95 @@ Ref<Cell> Dictionary::lookup_ref(td::ConstBitPtr key, int key_len) {
   return extract_value_ref(lookup(key, key_len));
 }
 
+namespace {
+// a key to look up and its position in the request
+using LookupManyKey = std::pair<td::ConstBitPtr, std::size_t>;
+
+// Descends the subtree of `cell` (with n key bits left) once for the sorted keys [begin, end),
+// which share their first `depth` bits. The keys continuing with the label of a node form a subrange of the keys,
+// and those of its left subtree precede those of its right one, so each node is parsed once for all keys below it.
+// Stores the value (with its extra for augmented dictionaries) of every key found into res.
+void dict_lookup_many(Ref<Cell> cell, int n, int auto_validate, LookupManyKey* begin, LookupManyKey* end, int depth,
+                      std::vector<Ref<CellSlice>>& res) {
+  unsigned char label_buffer[DictionaryBase::max_key_bytes];
+  while (true) {
+    dict::LabelParser label{std::move(cell), n, auto_validate};
+    int l_bits = label.l_bits;
+    td::ConstBitPtr label_bits = label.bits();
+    if (label.l_same) {
+      label.copy_label_prefix_to(td::BitPtr{label_buffer}, l_bits);
+      label_bits = td::ConstBitPtr{label_buffer};
+    }
+    auto compare = [&](const LookupManyKey& key) {
+      return td::bitstring::bits_memcmp(key.first + depth, label_bits, l_bits);
+    };
+    begin = std::partition_point(begin, end, [&](const LookupManyKey& key) { return compare(key) < 0; });
+    end = std::partition_point(begin, end, [&](const LookupManyKey& key) { return compare(key) == 0; });
+    if (begin == end) {
+      return;
+    }
+    n -= l_bits;
+    depth += l_bits;
+    if (n <= 0) {
+      assert(!n);
+      Ref<CellSlice> cs = std::move(label.remainder);
+      cs.write().advance(label.s_bits);
+      for (auto it = begin; it != end; ++it) {
+        res[it->second] = cs;
+      }
+      return;
+    }
+    auto middle = std::partition_point(begin, end, [&](const LookupManyKey& key) { return !*(key.first + depth); });
+    --n;
+    ++depth;
+    if (begin != middle) {
+      dict_lookup_many(label.remainder->prefetch_ref(0), n, auto_validate, begin, middle, depth, res);
+    }
+    if (middle == end) {
+      return;
+    }
+    cell = label.remainder->prefetch_ref(1);
+    begin = middle;
+  }
+}
+
+std::vector<Ref<CellSlice>> dict_lookup_many(Ref<Cell> root, int auto_validate, td::Span<td::ConstBitPtr> keys,
+                                             int key_len) {
+  std::vector<Ref<CellSlice>> res(keys.size());
+  if (root.is_null() || keys.empty()) {
+    return res;
+  }
+  if (!key_len) {
+    auto cs = load_cell_slice_ref(std::move(root));
+    for (auto& value : res) {
+      value = cs;
+    }
+    return res;
+  }
+  std::vector<LookupManyKey> sorted;
+  sorted.reserve(keys.size());
+  for (std::size_t i = 0; i < keys.size(); i++) {
+    sorted.emplace_back(keys[i], i);
+  }
+  auto less = [&](const LookupManyKey& a, const LookupManyKey& b) {
+    return td::bitstring::bits_memcmp(a.first, b.first, key_len) < 0;
+  };
+  if (!std::is_sorted(sorted.begin(), sorted.end(), less)) {
+    std::sort(sorted.begin(), sorted.end(), less);
+  }
+  dict_lookup_many(std::move(root), key_len, auto_validate, sorted.data(), sorted.data() + sorted.size(), 0, res);
+  return res;
+}
+}  // namespace
+
+std::vector<Ref<CellSlice>> Dictionary::lookup_many(td::Span<td::ConstBitPtr> keys, int key_len) {
+  force_validate();
+  if (key_len != get_key_bits()) {
+    return std::vector<Ref<CellSlice>>(keys.size());
+  }
+  return dict_lookup_many(get_root_cell(), dict::LabelParser::chk_all, keys, key_len);
+}
+
 bool Dictionary::has_common_prefix(td::ConstBitPtr prefix, int prefix_len) {
   force_validate();
   if (is_empty() || prefix_len <= 0) {
@@ -1961,6 +2052,20 @@ Ref<Cell> AugmentedDictionary::lookup_ref(td::ConstBitPtr key, int key_len) {
   }
 }
 
+std::vector<Ref<CellSlice>> AugmentedDictionary::lookup_many(td::Span<td::ConstBitPtr> keys, int key_len) {
+  force_validate();
+  if (key_len != get_key_bits()) {
+    return std::vector<Ref<CellSlice>>(keys.size());
+  }
+  auto res = dict_lookup_many(get_root_cell(), dict::LabelParser::chk_size, keys, key_len);
+  for (auto& cs : res) {
+    if (cs.not_null() && !aug.skip_extra(cs.write())) {
+      cs.clear();
+    }
+  }
+  return res;
+}
+
 std::pair<Ref<CellSlice>, Ref<CellSlice>> AugmentedDictionary::lookup_extra(td::ConstBitPtr key, int key_len) {
   auto cs = lookup_with_extra(key, key_len);
   if (cs.is_null()) {
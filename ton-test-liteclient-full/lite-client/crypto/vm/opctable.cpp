@@ -8,6 +8,7 @@
 #include <iomanip>
 #include <sstream>
 #include <functional>
+#include <type_traits>
 
 #include "td/utils/format.h"
 
@@ -39,10 +40,29 @@ DispatchTable* OpcodeTable::finalize() {
   }
 
   instruction_list.shrink_to_fit();
+  lookup_root = build_lookup_table(0, max_opcode_bits - lookup_bits);
   final = true;
   return this;
 }
 
+// builds the table for the opcodes opcode_min .. opcode_min + (lookup_size << shift) - 1, one entry per 1 << shift opcodes
+auto OpcodeTable::build_lookup_table(unsigned opcode_min, unsigned shift) -> const LookupEntry* {
+  std::unique_ptr<LookupEntry[]> table{new LookupEntry[lookup_size]};
+  for (unsigned i = 0; i < lookup_size; i++) {
+    unsigned lo = opcode_min + (i << shift), hi = lo + (1U << shift);
+    auto instr = find_instr(lo);
+    auto range = instr->get_opcode_range();
+    if (range.second >= hi) {
+      table[i].instr = instr;
+    } else {
+      assert(shift >= lookup_bits);
+      table[i].next = build_lookup_table(lo, shift - lookup_bits);
+    }
+  }
+  lookup_tables.push_back(std::move(table));
+  return lookup_tables.back().get();
+}
+
 OpcodeTable& OpcodeTable::insert(const OpcodeInstr* instr) {
   LOG_IF(FATAL, !insert_bool(instr)) << td::format::lambda([&](auto& sb) {
     sb << "cannot insert instruction into table " << name << ": ";
@@ -83,6 +103,18 @@ bool OpcodeTable::insert_bool(const OpcodeInstr* instr) {
 }
 
 const OpcodeInstr* OpcodeTable::lookup_instr(unsigned opcode, unsigned bits) const {
+  static_assert(max_opcode_bits == 3 * lookup_bits, "opcode lookup expects three levels");
+  auto entry = &lookup_root[opcode >> (2 * lookup_bits)];
+  if (!entry->instr) {
+    entry = &entry->next[(opcode >> lookup_bits) & (lookup_size - 1)];
+    if (!entry->instr) {
+      entry = &entry->next[opcode & (lookup_size - 1)];
+    }
+  }
+  return entry->instr;
+}
+
+const OpcodeInstr* OpcodeTable::find_instr(unsigned opcode) const {
   std::size_t i = 0, j = instruction_list.size();
   assert(j);
   while (j - i > 1) {
@@ -126,6 +158,15 @@ int OpcodeTable::instr_len(const CellSlice& cs) const {
   return instr->instr_len(cs, opcode, bits);
 }
 
+namespace {
+// the plain function wrapped by f, if any; calling it directly saves the indirection of std::function
+template <class F>
+auto get_fn(const std::function<F>& f) -> typename std::add_pointer<F>::type {
+  auto ptr = f.template target<typename std::add_pointer<F>::type>();
+  return ptr ? *ptr : nullptr;
+}
+}  // namespace
+
 OpcodeInstr::OpcodeInstr(unsigned _opcode, unsigned _bits, bool)
     : min_opcode(_opcode << (max_opcode_bits - _bits)), max_opcode((_opcode + 1) << (max_opcode_bits - _bits)) {
   assert(_opcode < (1U << _bits) && _bits <= max_opcode_bits);
@@ -181,7 +222,8 @@ OpcodeInstrSimplest::OpcodeInstrSimplest(unsigned opcode, unsigned _opc_bits, st
     : OpcodeInstr(opcode, _opc_bits, false)
     , opc_bits(static_cast<unsigned char>(_opc_bits))
     , name(_name)
-    , exec_instr(exec) {
+    , exec_instr(exec)
+    , exec_instr_fn(get_fn(exec_instr)) {
 }
 
 int OpcodeInstrSimplest::dispatch(VmState* st, CellSlice& cs, unsigned opcode, unsigned bits) const {
@@ -190,7 +232,7 @@ int OpcodeInstrSimplest::dispatch(VmState* st, CellSlice& cs, unsigned opcode, u
     throw VmError{Excno::inv_opcode, "invalid or too short opcode", opcode + (bits << max_opcode_bits)};
   }
   cs.advance(opc_bits);
-  return exec_instr(st);
+  return exec_instr_fn ? exec_instr_fn(st) : exec_instr(st);
 }
 
 std::string OpcodeInstrSimplest::dump(CellSlice& cs, unsigned opcode, unsigned bits) const {
@@ -215,7 +257,8 @@ OpcodeInstrFixed::OpcodeInstrFixed(unsigned opcode, unsigned _opc_bits, unsigned
     , opc_bits(static_cast<unsigned char>(_opc_bits))
     , tot_bits(static_cast<unsigned char>(_opc_bits + _arg_bits))
     , dump_instr(dump)
-    , exec_instr(exec) {
+    , exec_instr(exec)
+    , exec_instr_fn(get_fn(exec_instr)) {
   assert(_arg_bits <= max_opcode_bits && _opc_bits <= max_opcode_bits && _arg_bits + _opc_bits <= max_opcode_bits);
 }
 
@@ -225,7 +268,8 @@ OpcodeInstrFixed::OpcodeInstrFixed(unsigned opcode_min, unsigned opcode_max, uns
     , opc_bits(static_cast<unsigned char>(_tot_bits - _arg_bits))
     , tot_bits(static_cast<unsigned char>(_tot_bits))
     , dump_instr(dump)
-    , exec_instr(exec) {
+    , exec_instr(exec)
+    , exec_instr_fn(get_fn(exec_instr)) {
   assert(_arg_bits <= _tot_bits && _tot_bits <= max_opcode_bits);
   assert(opcode_min < opcode_max && opcode_max <= (1U << _tot_bits));
 }
@@ -236,7 +280,8 @@ int OpcodeInstrFixed::dispatch(VmState* st, CellSlice& cs, unsigned opcode, unsi
     throw VmError{Excno::inv_opcode, "invalid or too short opcode", opcode + (bits << max_opcode_bits)};
   }
   cs.advance(tot_bits);
-  return exec_instr(st, opcode >> (max_opcode_bits - tot_bits));
+  auto args = opcode >> (max_opcode_bits - tot_bits);
+  return exec_instr_fn ? exec_instr_fn(st, args) : exec_instr(st, args);
 }
 
 std::string OpcodeInstrFixed::dump(CellSlice& cs, unsigned opcode, unsigned bits) const {
@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 #include <map>
+#include <memory>
 
 namespace vm {
 
@@ -14,6 +15,9 @@ typedef std::function<std::string(CellSlice&, unsigned)> dump_arg_instr_func_t;
 typedef std::function<int(VmState* st, CellSlice&, unsigned, int)> exec_instr_func_t;
 typedef std::function<int(VmState* st, unsigned)> exec_arg_instr_func_t;
 typedef std::function<int(VmState* st)> exec_simple_instr_func_t;
+// plain function pointers wrapped by the std::function's above, called directly when available
+typedef int (*exec_arg_instr_fn_t)(VmState* st, unsigned);
+typedef int (*exec_simple_instr_fn_t)(VmState* st);
 
 enum { max_opcode_bits = 24 };
 const unsigned top_opcode = (1U << max_opcode_bits);
@@ -68,8 +72,17 @@ dump_arg_instr_func_t dump_2c_add(unsigned add, std::string prefix, std::string
 }  // namespace instr
 
 class OpcodeTable : public DispatchTable {
+  // one level of the lookup table, indexed by the next 8 bits of the opcode;
+  // next is used if the instructions of this 8-bit prefix are not all the same
+  struct LookupEntry {
+    const OpcodeInstr* instr{nullptr};
+    const LookupEntry* next{nullptr};
+  };
+  enum { lookup_bits = 8, lookup_size = 1 << lookup_bits };
   std::map<unsigned, const OpcodeInstr*> instructions;
   std::vector<std::pair<unsigned, const OpcodeInstr*>> instruction_list;
+  std::vector<std::unique_ptr<LookupEntry[]>> lookup_tables;
+  const LookupEntry* lookup_root{nullptr};
   std::string name;
   Codepage codepage;
   bool final;
@@ -95,6 +108,8 @@ class OpcodeTable : public DispatchTable {
  private:
   const OpcodeInstr* lookup_instr(unsigned opcode, unsigned bits) const;
   const OpcodeInstr* lookup_instr(const CellSlice& cs, unsigned& opcode, unsigned& bits) const;
+  const OpcodeInstr* find_instr(unsigned opcode) const;
+  const LookupEntry* build_lookup_table(unsigned opcode_min, unsigned shift);
 };
 
 class OpcodeInstrDummy : public OpcodeInstr {
@@ -124,6 +139,7 @@ class OpcodeInstrSimplest : public OpcodeInstr {
   unsigned char opc_bits;
   std::string name;
   exec_simple_instr_func_t exec_instr;
+  exec_simple_instr_fn_t exec_instr_fn;
 
  public:
   OpcodeInstrSimplest() = delete;
@@ -139,6 +155,7 @@ class OpcodeInstrFixed : public OpcodeInstr {
   std::string name;
   dump_arg_instr_func_t dump_instr;
   exec_arg_instr_func_t exec_instr;
+  exec_arg_instr_fn_t exec_instr_fn;
 
  public:
   OpcodeInstrFixed() = delete;
@@ -37,6 +37,21 @@ std::string str_to_hex(std::string data, std::string prefix) {
   return prefix;
 }
 
+td::RefInt256 StackEntry::make_int(long long val) {
+  if (val >= -td::BigIntInfo::Half && val < td::BigIntInfo::Half) {
+    return td::RefInt256{true, val};  // a single normalized digit
+  }
+  // normalize() would overflow for values close to 2^63
+  unsigned char buff[8];
+  for (auto& c : buff) {
+    c = static_cast<unsigned char>(val);
+    val >>= 8;
+  }
+  td::RefInt256 res{true};
+  res.unique_write().import_bytes_lsb(buff, 8);
+  return res;
+}
+
 std::string StackEntry::to_string() const {
   std::ostringstream os;
   dump(os);
@@ -271,10 +286,16 @@ td::RefInt256 Stack::pop_int_finite() {
 }
 
 bool Stack::pop_bool() {
+  if (!is_empty() && tos().is_smallint()) {
+    return pop().as_smallint() != 0;
+  }
   return sgn(pop_int_finite()) != 0;
 }
 
 long long Stack::pop_long() {
+  if (!is_empty() && tos().is_smallint()) {
+    return pop().as_smallint();
+  }
   return pop_int()->to_long();
 }
 
@@ -375,7 +396,15 @@ void Stack::push_int(td::RefInt256 val) {
   if (!val->signed_fits_bits(257)) {
     throw VmError{Excno::int_ov};
   }
-  push(std::move(val));
+  push_int_unchecked(std::move(val));
+}
+
+void Stack::push_int_unchecked(td::RefInt256 val) {
+  if (val->signed_fits_bits(64)) {
+    push_smallint(val->to_long());
+  } else {
+    push(std::move(val));
+  }
 }
 
 void Stack::push_int_quiet(td::RefInt256 val, bool quiet) {
@@ -387,7 +416,7 @@ void Stack::push_int_quiet(td::RefInt256 val, bool quiet) {
       return;
     }
   }
-  push(std::move(val));
+  push_int_unchecked(std::move(val));
 }
 
 void Stack::push_string(std::string str) {
@@ -407,7 +436,7 @@ void Stack::push_builder(Ref<CellBuilder> cb) {
 }
 
 void Stack::push_smallint(long long val) {
-  push(td::RefInt256{true, val});
+  stack.emplace_back(val);
 }
 
 void Stack::push_bool(bool val) {
@@ -59,6 +59,7 @@ class StackEntry {
 
  private:
   RefAny ref;
+  long long small_int{0};  // value of an integer kept inline, without ref (see is_smallint)
   Type tp;
 
  public:
@@ -74,6 +75,8 @@ class StackEntry {
   }
   StackEntry(td::RefInt256 int_ref) : ref(std::move(int_ref)), tp(t_int) {
   }
+  explicit StackEntry(long long val) : ref(), small_int(val), tp(t_int) {
+  }
   StackEntry(std::string str, bool bytes = false) : ref(), tp(bytes ? t_bytes : t_string) {
     auto cnt_str = new Cnt<std::string>{std::move(str)};
     ref = Ref<Cnt<std::string>>{cnt_str};
@@ -82,9 +85,9 @@ class StackEntry {
   StackEntry(Ref<Continuation> cont_ref);
   StackEntry(Ref<Box> box_ref);
   StackEntry(Ref<Tuple> tuple_ref);
-  StackEntry(const StackEntry& se) noexcept : ref(se.ref), tp(se.tp) {
+  StackEntry(const StackEntry& se) noexcept : ref(se.ref), small_int(se.small_int), tp(se.tp) {
   }
-  StackEntry(StackEntry&& se) noexcept : ref(std::move(se.ref)), tp(se.tp) {
+  StackEntry(StackEntry&& se) noexcept : ref(std::move(se.ref)), small_int(se.small_int), tp(se.tp) {
     se.tp = t_null;
   }
   template <class T>
@@ -92,11 +95,13 @@ class StackEntry {
   }
   StackEntry& operator=(const StackEntry& se) {
     ref = se.ref;
+    small_int = se.small_int;
     tp = se.tp;
     return *this;
   }
   StackEntry& operator=(StackEntry&& se) {
     ref = std::move(se.ref);
+    small_int = se.small_int;
     tp = se.tp;
     se.tp = t_null;
     return *this;
@@ -114,13 +119,22 @@ class StackEntry {
   }
   void swap(StackEntry& se) {
     ref.swap(se.ref);
+    std::swap(small_int, se.small_int);
     std::swap(tp, se.tp);
   }
   Type type() const {
     return tp;
   }
+  // integers that fit into 64 bits may be kept inline, as_int() allocates a BigInt256 for them
+  bool is_smallint() const {
+    return tp == t_int && ref.is_null();
+  }
+  long long as_smallint() const {
+    return small_int;
+  }
 
  private:
+  static td::RefInt256 make_int(long long val);
   template <typename T, Type tag>
   Ref<T> dynamic_as() const & {
     return tp == tag ? static_cast<Ref<T>>(ref) : td::Ref<T>{};
@@ -148,10 +162,10 @@ class StackEntry {
 
  public:
   td::RefInt256 as_int() const & {
-    return as<td::CntInt256, t_int>();
+    return is_smallint() ? make_int(small_int) : as<td::CntInt256, t_int>();
   }
   td::RefInt256 as_int() && {
-    return move_as<td::CntInt256, t_int>();
+    return is_smallint() ? make_int(small_int) : move_as<td::CntInt256, t_int>();
   }
   Ref<Cell> as_cell() const & {
     return as<Cell, t_cell>();
@@ -403,6 +417,9 @@ class Stack : public td::CntObject {
   void push_box(Ref<Box> box);
   void push_tuple(Ref<Tuple> tuple);
   void dump(std::ostream& os, bool cr = true) const;
+
+ private:
+  void push_int_unchecked(td::RefInt256 val);
 };
 
 }  // namespace vm
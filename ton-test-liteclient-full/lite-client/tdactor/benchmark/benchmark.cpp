@@ -19,6 +19,7 @@ extern "C" {
 #include "td/actor/actor.h"
 
 #include "td/utils/benchmark.h"
+#include "td/utils/buffer.h"
 #include "td/utils/crypto.h"
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
@@ -27,6 +28,7 @@ extern "C" {
 #include "td/utils/port/thread.h"
 #include "td/utils/queue.h"
 #include "td/utils/Random.h"
+#include "td/utils/Sha256Batch.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
 
@@ -137,6 +139,22 @@ class BlockSha256Baseline {
   }
 };
 
+class BlockSha256Batch {
+ public:
+  static std::string get_description() {
+    return PSTRING() << "Batch " << td::sha256_batch_implementation();
+  }
+  static void calc_hash(Block &block) {
+    std::vector<td::Slice> inputs;
+    std::vector<td::MutableSlice> outputs;
+    for (auto &cell : block.cells) {
+      inputs.push_back(cell.data);
+      outputs.push_back(as_slice(cell.hash));
+    }
+    td::sha256_batch(inputs, outputs);
+  }
+};
+
 class BlockSha256Threads {
  public:
   static std::string get_description() {
@@ -677,6 +695,127 @@ class CalcHashSha256Benchmark : public td::Benchmark {
   Block block_;
 };
 
+// SHA-256 of short messages, e.g. representations of cells, one by one or in batches
+class Sha256ShortMessagesBenchmark : public td::Benchmark {
+ public:
+  Sha256ShortMessagesBenchmark(size_t message_size, size_t batch_size)
+      : message_size_(message_size), batch_size_(batch_size) {
+  }
+  std::string get_description() const override {
+    if (batch_size_ == 0) {
+      return PSTRING() << "Sha256: " << message_size_ << "-byte messages one by one";
+    }
+    return PSTRING() << "Sha256: " << message_size_ << "-byte messages in batches of " << batch_size_ << " ("
+                     << td::sha256_batch_implementation() << ")";
+  }
+  void start_up() override {
+    data_ = Generator::random_bytes(td::narrow_cast<int>(message_size_ * messages_count));
+    hashes_.resize(messages_count);
+    for (size_t i = 0; i < messages_count; i++) {
+      inputs_.push_back(td::Slice(data_).substr(i * message_size_, message_size_));
+      outputs_.push_back(as_slice(hashes_[i]));
+    }
+  }
+
+  void run(int n) override {
+    size_t step = td::max<size_t>(batch_size_, 1);
+    for (int i = 0; i < n; i += static_cast<int>(step)) {
+      auto pos = static_cast<size_t>(i) % messages_count;
+      if (batch_size_ == 0) {
+        td::sha256(inputs_[pos], outputs_[pos]);
+      } else {
+        td::sha256_batch(td::Span<td::Slice>(inputs_.data() + pos, step),
+                         td::Span<td::MutableSlice>(outputs_.data() + pos, step));
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t messages_count = 1 << 10;
+  size_t message_size_;
+  size_t batch_size_;
+  std::string data_;
+  std::vector<td::UInt256> hashes_;
+  std::vector<td::Slice> inputs_;
+  std::vector<td::MutableSlice> outputs_;
+};
+
+class AesCtrFramingBenchmark : public td::Benchmark {
+ public:
+  explicit AesCtrFramingBenchmark(bool in_place) : in_place_(in_place) {
+  }
+  std::string get_description() const override {
+    return PSTRING() << "AesCtrFraming: " << (in_place_ ? "in place" : "copy") << " " << (packet_size() >> 10)
+                     << "KB packets";
+  }
+  void start_up() override {
+    td::UInt256 key;
+    td::UInt128 iv;
+    td::Random::secure_bytes(key.as_slice());
+    td::Random::secure_bytes(iv.as_slice());
+    ctr_.init(key, iv);
+  }
+
+  void run(int n) override {
+    for (int i = 0; i < n; i++) {
+      td::BufferSlice data{packet_size()};
+      td::ChainBufferWriter output;
+      if (in_place_) {
+        frame_in_place(std::move(data), output);
+      } else {
+        frame_copy(std::move(data), output);
+      }
+    }
+  }
+
+ private:
+  static size_t packet_size() {
+    return 1 << 16;
+  }
+
+  // the way AdnlExtConnection::send used to build a packet
+  void frame_copy(td::BufferSlice data, td::ChainBufferWriter &output) {
+    td::BufferSlice d{data.size() + 4 + 32 + 32};
+    auto S = d.as_slice();
+    auto data_size = static_cast<td::uint32>(data.size() + 32 + 32);
+    S.copy_from(td::Slice(reinterpret_cast<const td::uint8 *>(&data_size), 4));
+    S.remove_prefix(4);
+    auto Sc = S;
+    td::Random::secure_bytes(S.copy().truncate(32));
+    S.remove_prefix(32);
+    S.copy_from(data.as_slice());
+    S.remove_prefix(data.size());
+    td::sha256(Sc.truncate(32 + data.size()), S);
+    td::BufferSlice e{d.size()};
+    ctr_.encrypt(d.as_slice(), e.as_slice());
+    output.append(std::move(e));
+  }
+
+  void frame_in_place(td::BufferSlice data, td::ChainBufferWriter &output) {
+    char header[4 + 32];
+    td::MutableSlice H{header, sizeof(header)};
+    auto data_size = static_cast<td::uint32>(data.size() + 32 + 32);
+    H.copy_from(td::Slice(reinterpret_cast<const td::uint8 *>(&data_size), 4));
+    auto nonce = H.substr(4);
+    td::Random::secure_bytes(nonce);
+    td::UInt256 checksum;
+    td::Sha256State sha;
+    sha.init();
+    sha.feed(nonce);
+    sha.feed(data.as_slice());
+    sha.extract(checksum.as_slice());
+    ctr_.encrypt(H, H);
+    ctr_.encrypt(data.as_slice(), data.as_slice());
+    ctr_.encrypt(checksum.as_slice(), checksum.as_slice());
+    output.append(H);
+    output.append(std::move(data));
+    output.append(checksum.as_slice());
+  }
+
+  bool in_place_;
+  td::AesCtrState ctr_;
+};
+
 /*
 template <class T>
 class MpmcQueueInterface {
@@ -1131,6 +1270,8 @@ int main(int argc, char **argv) {
     return 0;
   }
 
+  bench(AesCtrFramingBenchmark(false));
+  bench(AesCtrFramingBenchmark(true));
   bench(ActorDummyQuery());
   bench(ActorExecutorBenchmark());
   bench(ActorSignalQuery());
@@ -1139,6 +1280,13 @@ int main(int argc, char **argv) {
   bench(CalcHashSha256Benchmark<BlockSha256Actors>());
   bench(CalcHashSha256Benchmark<BlockSha256Threads>());
   bench(CalcHashSha256Benchmark<BlockSha256Baseline>());
+  bench(CalcHashSha256Benchmark<BlockSha256Batch>());
+  for (size_t message_size : {2, 42, 110, 266}) {
+    bench(Sha256ShortMessagesBenchmark(message_size, 0));
+    bench(Sha256ShortMessagesBenchmark(message_size, 1));
+    bench(Sha256ShortMessagesBenchmark(message_size, 16));
+    bench(Sha256ShortMessagesBenchmark(message_size, 64));
+  }
   bench(ActorLockerBenchmark(1));
   bench(ActorLockerBenchmark(2));
   bench(ActorLockerBenchmark(5));
@@ -0,0 +1,218 @@
+#include "td/utils/Sha256Batch.h"
+
+#include "td/utils/crypto.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/platform.h"
+#include "td/utils/Sha256BatchKernels.h"
+
+#include <cstring>
+
+#if (TD_GCC || TD_CLANG) && (defined(__x86_64__) || defined(__i386__))
+#define TD_SHA256_BATCH_X86 1
+#include <cpuid.h>
+#else
+#define TD_SHA256_BATCH_X86 0
+#endif
+
+namespace td {
+
+#if TD_HAVE_OPENSSL
+namespace {
+using detail::Sha256BatchKernelInfo;
+using detail::Sha256BatchLane;
+
+// longer messages gain nothing from batching and are hashed one by one
+constexpr size_t max_batch_blocks = 16;
+constexpr size_t max_lanes = 16;
+
+size_t sha256_block_count(size_t size) {
+  return (size + 9 + 63) / 64;
+}
+
+void prepare_lane(Slice input, MutableSlice output, Sha256BatchLane &lane) {
+  CHECK(output.size() >= 32);
+  auto size = input.size();
+  lane.data = input.ubegin();
+  lane.full_blocks = size / 64;
+  lane.out = output.ubegin();
+  auto rest = size % 64;
+  auto tail_size = (sha256_block_count(size) - lane.full_blocks) * 64;
+  std::memset(lane.tail, 0, tail_size);
+  std::memcpy(lane.tail, input.ubegin() + lane.full_blocks * 64, rest);
+  lane.tail[rest] = 0x80;
+  uint64 bit_size = static_cast<uint64>(size) * 8;
+  for (int i = 0; i < 8; i++) {
+    lane.tail[tail_size - 1 - i] = static_cast<unsigned char>(bit_size >> (8 * i));
+  }
+}
+
+struct Sha256BatchImpl {
+  Sha256BatchKernelInfo multi{"generic", 1, nullptr};
+  // used for a few messages of the same length that cannot fill the lanes of the multi-buffer kernel
+  Sha256BatchKernelInfo single{"generic", 1, nullptr};
+};
+
+// the kernels compiled in and supported by this CPU
+struct Sha256BatchKernels {
+  Sha256BatchKernelInfo sha_ni{"sha-ni", 1, nullptr};
+  Sha256BatchKernelInfo avx512{"avx512", 16, nullptr};
+  Sha256BatchKernelInfo avx2{"avx2", 8, nullptr};
+};
+
+Sha256BatchKernels detect_sha256_batch_kernels() {
+  Sha256BatchKernels kernels;
+#if TD_SHA256_BATCH_X86
+  __builtin_cpu_init();
+  // there is no __builtin_cpu_supports("sha") in older compilers; it is CPUID.(EAX=7,ECX=0):EBX bit 29
+  unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (__builtin_cpu_supports("sse4.1") && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && ((ebx >> 29) & 1)) {
+    kernels.sha_ni = detail::sha256_batch_sha_ni_kernel();
+  }
+  if (__builtin_cpu_supports("avx512f")) {
+    kernels.avx512 = detail::sha256_batch_avx512_kernel();
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    kernels.avx2 = detail::sha256_batch_avx2_kernel();
+  }
+#endif
+  return kernels;
+}
+
+const Sha256BatchKernels &sha256_batch_kernels() {
+  static const Sha256BatchKernels kernels = detect_sha256_batch_kernels();
+  return kernels;
+}
+
+Sha256BatchImpl choose_sha256_batch_impl() {
+  auto &kernels = sha256_batch_kernels();
+  Sha256BatchImpl impl;
+  if (kernels.sha_ni.kernel != nullptr) {
+    impl.single = kernels.sha_ni;
+  }
+  if (kernels.avx512.kernel != nullptr) {
+    impl.multi = kernels.avx512;
+  }
+  // one message at a time with the SHA extensions is faster than eight at a time with AVX2
+  if (impl.multi.kernel == nullptr && impl.single.kernel == nullptr && kernels.avx2.kernel != nullptr) {
+    impl.multi = kernels.avx2;
+  }
+  if (impl.multi.kernel == nullptr) {
+    impl.multi = impl.single;
+  }
+  return impl;
+}
+
+const Sha256BatchImpl &sha256_batch_impl() {
+  static const Sha256BatchImpl impl = choose_sha256_batch_impl();
+  return impl;
+}
+
+void sha256_single(const Sha256BatchImpl &impl, Slice input, MutableSlice output) {
+  if (impl.single.kernel == nullptr || sha256_block_count(input.size()) > max_batch_blocks) {
+    sha256(input, output);
+    return;
+  }
+  Sha256BatchLane lane;
+  prepare_lane(input, output, lane);
+  impl.single.kernel(&lane, sha256_block_count(input.size()));
+}
+
+void do_sha256_batch(const Sha256BatchImpl &impl, Span<Slice> inputs, Span<MutableSlice> outputs) {
+  CHECK(inputs.size() == outputs.size());
+  auto lanes_n = impl.multi.lanes;
+  if (lanes_n == 1 || inputs.size() == 1) {
+    for (size_t i = 0; i < inputs.size(); i++) {
+      sha256_single(impl, inputs[i], outputs[i]);
+    }
+    return;
+  }
+
+  // messages of the same length in blocks are hashed together; the lanes of an incomplete group are filled
+  // with copies of its first message unless it is cheaper to hash the few messages one by one
+  uint32 present = 0;
+  for (auto &input : inputs) {
+    auto blocks = sha256_block_count(input.size());
+    if (blocks <= max_batch_blocks) {
+      present |= 1u << (blocks - 1);
+    }
+  }
+  Sha256BatchLane lanes[max_lanes];
+  unsigned char dummy_output[32];
+  for (size_t blocks = 1; blocks <= max_batch_blocks; blocks++) {
+    if (!((present >> (blocks - 1)) & 1)) {
+      continue;
+    }
+    size_t used = 0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+      if (sha256_block_count(inputs[i].size()) != blocks) {
+        continue;
+      }
+      prepare_lane(inputs[i], outputs[i], lanes[used]);
+      if (++used == lanes_n) {
+        impl.multi.kernel(lanes, blocks);
+        used = 0;
+      }
+    }
+    if (used == 0) {
+      continue;
+    }
+    if (impl.single.kernel != nullptr && used * 3 <= lanes_n * 2) {
+      for (size_t i = 0; i < used; i++) {
+        impl.single.kernel(&lanes[i], blocks);
+      }
+      continue;
+    }
+    for (size_t i = used; i < lanes_n; i++) {
+      lanes[i] = lanes[0];
+      lanes[i].out = dummy_output;
+    }
+    impl.multi.kernel(lanes, blocks);
+  }
+  for (size_t i = 0; i < inputs.size(); i++) {
+    if (sha256_block_count(inputs[i].size()) > max_batch_blocks) {
+      sha256(inputs[i], outputs[i]);
+    }
+  }
+}
+
+}  // namespace
+
+void sha256_batch(Span<Slice> inputs, Span<MutableSlice> outputs) {
+  do_sha256_batch(sha256_batch_impl(), inputs, outputs);
+}
+
+std::vector<Slice> sha256_batch_implementations() {
+  auto &kernels = sha256_batch_kernels();
+  std::vector<Slice> res;
+  for (auto *info : {&kernels.sha_ni, &kernels.avx512, &kernels.avx2}) {
+    if (info->kernel != nullptr) {
+      res.push_back(Slice(info->name));
+    }
+  }
+  res.push_back(Slice("generic"));
+  return res;
+}
+
+void sha256_batch_with(Slice implementation, Span<Slice> inputs, Span<MutableSlice> outputs) {
+  // the chosen kernel alone: a multi-buffer kernel also gets the incomplete groups, padded with copies
+  auto &kernels = sha256_batch_kernels();
+  Sha256BatchImpl impl;
+  for (auto *info : {&kernels.sha_ni, &kernels.avx512, &kernels.avx2}) {
+    if (implementation == Slice(info->name)) {
+      CHECK(info->kernel != nullptr);
+      impl.multi = *info;
+      if (info->lanes == 1) {
+        impl.single = *info;
+      }
+    }
+  }
+  CHECK(impl.multi.kernel != nullptr || implementation == Slice("generic"));
+  do_sha256_batch(impl, inputs, outputs);
+}
+
+Slice sha256_batch_implementation() {
+  return Slice(sha256_batch_impl().multi.name);
+}
+#endif
+
+}  // namespace td
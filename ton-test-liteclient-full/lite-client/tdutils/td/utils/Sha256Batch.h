@@ -0,0 +1,29 @@
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+#include "td/utils/Span.h"
+
+#include <vector>
+
+namespace td {
+
+#if TD_HAVE_OPENSSL
+// Computes SHA-256 of many independent short messages at once.
+// On x86-64 the messages are hashed several at a time in the lanes of AVX-512 or AVX2 registers, or one by one
+// with the SHA extensions, whichever the CPU supports best; otherwise every message is hashed with td::sha256.
+// outputs[i] receives the 32-byte digest of inputs[i]; an output may not overlap any input.
+void sha256_batch(Span<Slice> inputs, Span<MutableSlice> outputs);
+
+// Name of the implementation chosen for this CPU, e.g. "avx512", "avx2", "sha-ni" or "generic"
+Slice sha256_batch_implementation();
+
+// Names of all implementations usable on this CPU, "generic" included
+std::vector<Slice> sha256_batch_implementations();
+
+// sha256_batch with the given implementation from sha256_batch_implementations() instead of the chosen one,
+// e.g. to check each of them
+void sha256_batch_with(Slice implementation, Span<Slice> inputs, Span<MutableSlice> outputs);
+#endif
+
+}  // namespace td
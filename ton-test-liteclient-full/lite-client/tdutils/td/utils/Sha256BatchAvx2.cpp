@@ -0,0 +1,59 @@
+// Compiled with -mavx2 (see tdutils/CMakeLists.txt); used only after a runtime check of the CPU
+#include "td/utils/Sha256BatchKernels.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace td {
+namespace detail {
+
+#if defined(__AVX2__)
+namespace {
+struct Avx2 {
+  using T = __m256i;
+  static constexpr std::size_t lanes = 8;
+
+  static T set1(std::uint32_t x) {
+    return _mm256_set1_epi32(static_cast<int>(x));
+  }
+  static T load(const std::uint32_t *ptr) {
+    return _mm256_load_si256(reinterpret_cast<const __m256i *>(ptr));
+  }
+  static void store(std::uint32_t *ptr, T x) {
+    _mm256_store_si256(reinterpret_cast<__m256i *>(ptr), x);
+  }
+  static T add(T a, T b) {
+    return _mm256_add_epi32(a, b);
+  }
+  static T xor3(T a, T b, T c) {
+    return _mm256_xor_si256(_mm256_xor_si256(a, b), c);
+  }
+  template <int n>
+  static T rotr(T x) {
+    return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+  }
+  template <int n>
+  static T shr(T x) {
+    return _mm256_srli_epi32(x, n);
+  }
+  static T ch(T e, T f, T g) {
+    return _mm256_xor_si256(_mm256_and_si256(e, _mm256_xor_si256(f, g)), g);
+  }
+  static T maj(T a, T b, T c) {
+    return _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+  }
+};
+}  // namespace
+
+Sha256BatchKernelInfo sha256_batch_avx2_kernel() {
+  return {"avx2", Avx2::lanes, sha256_multi_buffer<Avx2>};
+}
+#else
+Sha256BatchKernelInfo sha256_batch_avx2_kernel() {
+  return {"avx2", 8, nullptr};
+}
+#endif
+
+}  // namespace detail
+}  // namespace td
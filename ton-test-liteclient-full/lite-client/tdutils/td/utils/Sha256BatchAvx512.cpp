@@ -0,0 +1,59 @@
+// Compiled with -mavx512f (see tdutils/CMakeLists.txt); used only after a runtime check of the CPU
+#include "td/utils/Sha256BatchKernels.h"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace td {
+namespace detail {
+
+#if defined(__AVX512F__)
+namespace {
+struct Avx512 {
+  using T = __m512i;
+  static constexpr std::size_t lanes = 16;
+
+  static T set1(std::uint32_t x) {
+    return _mm512_set1_epi32(static_cast<int>(x));
+  }
+  static T load(const std::uint32_t *ptr) {
+    return _mm512_load_si512(ptr);
+  }
+  static void store(std::uint32_t *ptr, T x) {
+    _mm512_store_si512(ptr, x);
+  }
+  static T add(T a, T b) {
+    return _mm512_add_epi32(a, b);
+  }
+  static T xor3(T a, T b, T c) {
+    return _mm512_ternarylogic_epi32(a, b, c, 0x96);
+  }
+  template <int n>
+  static T rotr(T x) {
+    return _mm512_ror_epi32(x, n);
+  }
+  template <int n>
+  static T shr(T x) {
+    return _mm512_srli_epi32(x, n);
+  }
+  static T ch(T e, T f, T g) {
+    return _mm512_ternarylogic_epi32(e, f, g, 0xca);
+  }
+  static T maj(T a, T b, T c) {
+    return _mm512_ternarylogic_epi32(a, b, c, 0xe8);
+  }
+};
+}  // namespace
+
+Sha256BatchKernelInfo sha256_batch_avx512_kernel() {
+  return {"avx512", Avx512::lanes, sha256_multi_buffer<Avx512>};
+}
+#else
+Sha256BatchKernelInfo sha256_batch_avx512_kernel() {
+  return {"avx512", 16, nullptr};
+}
+#endif
+
+}  // namespace detail
+}  // namespace td
@@ -0,0 +1,134 @@
+#pragma once
+
+// Internal interface between td::sha256_batch and its SIMD kernels.
+// The kernels are compiled with instruction set specific flags, so this header (and everything the kernels include)
+// must not define non-template inline functions with external linkage: the linker could pick their copy compiled
+// for a newer instruction set for the whole program.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace td {
+namespace detail {
+
+// A message prepared for a kernel: complete 64-byte blocks are read in place,
+// the last one or two blocks, padded with the message length, are copied into tail.
+struct Sha256BatchLane {
+  const unsigned char *data;
+  std::size_t full_blocks;
+  unsigned char *out;
+  unsigned char tail[128];
+};
+
+// Hashes `lanes` messages (the kernel's lane count), each of which consists of exactly `blocks` blocks
+using Sha256BatchKernel = void (*)(const Sha256BatchLane *lanes, std::size_t blocks);
+
+struct Sha256BatchKernelInfo {
+  const char *name;
+  std::size_t lanes;
+  Sha256BatchKernel kernel;  // nullptr if the kernel was not compiled in
+};
+
+Sha256BatchKernelInfo sha256_batch_avx512_kernel();
+Sha256BatchKernelInfo sha256_batch_avx2_kernel();
+Sha256BatchKernelInfo sha256_batch_sha_ni_kernel();
+
+static constexpr std::uint32_t sha256_initial_state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                                          0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+static constexpr std::uint32_t sha256_round_constants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+static inline const unsigned char *sha256_lane_block(const Sha256BatchLane &lane, std::size_t i) {
+  return i < lane.full_blocks ? lane.data + i * 64 : lane.tail + (i - lane.full_blocks) * 64;
+}
+
+static inline std::uint32_t sha256_load_be32(const unsigned char *ptr) {
+  return (static_cast<std::uint32_t>(ptr[0]) << 24) | (static_cast<std::uint32_t>(ptr[1]) << 16) |
+         (static_cast<std::uint32_t>(ptr[2]) << 8) | static_cast<std::uint32_t>(ptr[3]);
+}
+
+static inline void sha256_store_be32(unsigned char *ptr, std::uint32_t x) {
+  ptr[0] = static_cast<unsigned char>(x >> 24);
+  ptr[1] = static_cast<unsigned char>(x >> 16);
+  ptr[2] = static_cast<unsigned char>(x >> 8);
+  ptr[3] = static_cast<unsigned char>(x);
+}
+
+// Multi-buffer SHA-256: lane i of every vector belongs to message i.
+// V provides the vector type T, its lane count and the lane-wise 32-bit operations.
+template <class V>
+void sha256_multi_buffer(const Sha256BatchLane *lanes, std::size_t blocks) {
+  using T = typename V::T;
+  constexpr std::size_t N = V::lanes;
+
+  T state[8];
+  for (int i = 0; i < 8; i++) {
+    state[i] = V::set1(sha256_initial_state[i]);
+  }
+  alignas(64) std::uint32_t words[16][N];
+  for (std::size_t b = 0; b < blocks; b++) {
+    for (std::size_t l = 0; l < N; l++) {
+      auto *block = sha256_lane_block(lanes[l], b);
+      for (int j = 0; j < 16; j++) {
+        words[j][l] = sha256_load_be32(block + 4 * j);
+      }
+    }
+    T w[16];
+    for (int j = 0; j < 16; j++) {
+      w[j] = V::load(words[j]);
+    }
+
+    T a = state[0], b_ = state[1], c = state[2], d = state[3];
+    T e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int i = 0; i < 64; i++) {
+      if (i >= 16) {
+        T w15 = w[(i + 1) & 15];
+        T w2 = w[(i + 14) & 15];
+        T s0 = V::xor3(V::template rotr<7>(w15), V::template rotr<18>(w15), V::template shr<3>(w15));
+        T s1 = V::xor3(V::template rotr<17>(w2), V::template rotr<19>(w2), V::template shr<10>(w2));
+        w[i & 15] = V::add(V::add(w[i & 15], s0), V::add(w[(i + 9) & 15], s1));
+      }
+      T sigma1 = V::xor3(V::template rotr<6>(e), V::template rotr<11>(e), V::template rotr<25>(e));
+      T t1 = V::add(V::add(h, sigma1), V::add(V::ch(e, f, g), V::add(V::set1(sha256_round_constants[i]), w[i & 15])));
+      T sigma0 = V::xor3(V::template rotr<2>(a), V::template rotr<13>(a), V::template rotr<22>(a));
+      T t2 = V::add(sigma0, V::maj(a, b_, c));
+      h = g;
+      g = f;
+      f = e;
+      e = V::add(d, t1);
+      d = c;
+      c = b_;
+      b_ = a;
+      a = V::add(t1, t2);
+    }
+    state[0] = V::add(state[0], a);
+    state[1] = V::add(state[1], b_);
+    state[2] = V::add(state[2], c);
+    state[3] = V::add(state[3], d);
+    state[4] = V::add(state[4], e);
+    state[5] = V::add(state[5], f);
+    state[6] = V::add(state[6], g);
+    state[7] = V::add(state[7], h);
+  }
+
+  alignas(64) std::uint32_t result[8][N];
+  for (int i = 0; i < 8; i++) {
+    V::store(result[i], state[i]);
+  }
+  for (std::size_t l = 0; l < N; l++) {
+    for (int i = 0; i < 8; i++) {
+      sha256_store_be32(lanes[l].out + 4 * i, result[i][l]);
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace td
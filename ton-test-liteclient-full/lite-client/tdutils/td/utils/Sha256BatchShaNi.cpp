@@ -0,0 +1,72 @@
+// Compiled with -msha -msse4.1 (see tdutils/CMakeLists.txt); used only after a runtime check of the CPU
+#include "td/utils/Sha256BatchKernels.h"
+
+#if defined(__SHA__) && defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+namespace td {
+namespace detail {
+
+#if defined(__SHA__) && defined(__SSE4_1__)
+namespace {
+// One message at a time with the SHA extensions; the state is kept as ABEF/CDGH as the instructions expect
+void sha256_sha_ni(const Sha256BatchLane *lanes, std::size_t blocks) {
+  const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+  auto &lane = lanes[0];
+
+  __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&sha256_initial_state[0]));
+  __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&sha256_initial_state[4]));
+  tmp = _mm_shuffle_epi32(tmp, 0xb1);                // CDAB
+  state1 = _mm_shuffle_epi32(state1, 0x1b);          // EFGH
+  __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);  // ABEF
+  state1 = _mm_blend_epi16(state1, tmp, 0xf0);       // CDGH
+
+  for (std::size_t b = 0; b < blocks; b++) {
+    auto *block = sha256_lane_block(lane, b);
+    __m128i abef = state0;
+    __m128i cdgh = state1;
+    __m128i w[4];
+    for (int r = 0; r < 16; r++) {
+      __m128i &cur = w[r & 3];
+      if (r < 4) {
+        cur = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 16 * r)), byte_swap);
+      } else {
+        // W[t..t+3] from W[t-16..t-1]
+        __m128i x = _mm_sha256msg1_epu32(cur, w[(r + 1) & 3]);
+        x = _mm_add_epi32(x, _mm_alignr_epi8(w[(r + 3) & 3], w[(r + 2) & 3], 4));
+        cur = _mm_sha256msg2_epu32(x, w[(r + 3) & 3]);
+      }
+      __m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&sha256_round_constants[4 * r]));
+      __m128i msg = _mm_add_epi32(cur, k);
+      state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+    }
+    state0 = _mm_add_epi32(state0, abef);
+    state1 = _mm_add_epi32(state1, cdgh);
+  }
+
+  tmp = _mm_shuffle_epi32(state0, 0x1b);        // FEBA
+  state1 = _mm_shuffle_epi32(state1, 0xb1);     // DCHG
+  state0 = _mm_blend_epi16(tmp, state1, 0xf0);  // DCBA
+  state1 = _mm_alignr_epi8(state1, tmp, 8);     // HGFE
+  alignas(16) std::uint32_t result[8];
+  _mm_store_si128(reinterpret_cast<__m128i *>(&result[0]), state0);
+  _mm_store_si128(reinterpret_cast<__m128i *>(&result[4]), state1);
+  for (int i = 0; i < 8; i++) {
+    sha256_store_be32(lane.out + 4 * i, result[i]);
+  }
+}
+}  // namespace
+
+Sha256BatchKernelInfo sha256_batch_sha_ni_kernel() {
+  return {"sha-ni", 1, sha256_sha_ni};
+}
+#else
+Sha256BatchKernelInfo sha256_batch_sha_ni_kernel() {
+  return {"sha-ni", 1, nullptr};
+}
+#endif
+
+}  // namespace detail
+}  // namespace td
@@ -4,6 +4,7 @@
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
 #include "td/utils/port/RwMutex.h"
+#include "td/utils/port/thread.h"
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Random.h"
 #include "td/utils/ScopeGuard.h"
@@ -32,6 +33,7 @@
 #include <cstring>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace td {
 
@@ -295,34 +297,35 @@ class AesCtrState::Impl {
  public:
   Impl(const UInt256 &key, const UInt128 &iv) {
     static_assert(AES_BLOCK_SIZE == 16, "");
-    if (AES_set_encrypt_key(key.raw, 256, &aes_key) < 0) {
-      LOG(FATAL) << "Failed to set encrypt key";
-    }
-    MutableSlice(counter, AES_BLOCK_SIZE).copy_from(as_slice(iv));
-    current_pos = 0;
+    ctx_ = EVP_CIPHER_CTX_new();
+    LOG_IF(FATAL, ctx_ == nullptr);
+    // EVP picks AES-NI when available; the counter is the whole 128-bit block, as before
+    int res = EVP_EncryptInit_ex(ctx_, EVP_aes_256_ctr(), nullptr, key.raw, iv.raw);
+    LOG_IF(FATAL, res != 1) << "Failed to set encrypt key";
+  }
+  Impl(const Impl &from) = delete;
+  Impl &operator=(const Impl &from) = delete;
+  Impl(Impl &&from) = delete;
+  Impl &operator=(Impl &&from) = delete;
+  ~Impl() {
+    EVP_CIPHER_CTX_free(ctx_);
   }
 
+  // from and to may be the same memory
   void encrypt(Slice from, MutableSlice to) {
     CHECK(to.size() >= from.size());
-    for (size_t i = 0; i < from.size(); i++) {
-      if (current_pos == 0) {
-        AES_encrypt(counter, encrypted_counter, &aes_key);
-        for (int j = 15; j >= 0; j--) {
-          if (++counter[j] != 0) {
-            break;
-          }
-        }
-      }
-      to[i] = static_cast<char>(from[i] ^ encrypted_counter[current_pos]);
-      current_pos = (current_pos + 1) & 15;
+    while (!from.empty()) {
+      auto chunk = min(from.size(), static_cast<size_t>(1) << 30);
+      int len = 0;
+      int res = EVP_EncryptUpdate(ctx_, to.ubegin(), &len, from.ubegin(), static_cast<int>(chunk));
+      LOG_IF(FATAL, res != 1 || static_cast<size_t>(len) != chunk);
+      from.remove_prefix(chunk);
+      to.remove_prefix(chunk);
     }
   }
 
  private:
-  AES_KEY aes_key;
-  uint8 counter[AES_BLOCK_SIZE];
-  uint8 encrypted_counter[AES_BLOCK_SIZE];
-  uint8 current_pos;
+  EVP_CIPHER_CTX *ctx_ = nullptr;
 };
 
 AesCtrState::AesCtrState() = default;
@@ -690,6 +693,38 @@ uint32 crc32c_extend(uint32 old_crc, uint32 data_crc, size_t data_size) {
   return old_crc ^ data_crc;
 }
 
+uint32 crc32c_parallel(Slice data, int threads_n) {
+#if TD_THREAD_UNSUPPORTED
+  threads_n = 1;
+#endif
+  // a thread is not worth it for less
+  constexpr size_t min_part_size = 1 << 22;
+  size_t parts_n = std::min(static_cast<size_t>(std::max(threads_n, 1)), data.size() / min_part_size);
+  if (parts_n <= 1) {
+    return crc32c(data);
+  }
+  auto part_size = data.size() / parts_n;
+  auto get_part = [&](size_t i) {
+    return i + 1 == parts_n ? data.substr(i * part_size) : data.substr(i * part_size, part_size);
+  };
+  std::vector<uint32> crcs(parts_n);
+#if !TD_THREAD_UNSUPPORTED
+  std::vector<td::thread> threads;
+  for (size_t i = 1; i < parts_n; i++) {
+    threads.emplace_back([&, i] { crcs[i] = crc32c(get_part(i)); });
+  }
+  crcs[0] = crc32c(get_part(0));
+  for (auto &thread : threads) {
+    thread.join();
+  }
+#endif
+  auto res = crcs[0];
+  for (size_t i = 1; i < parts_n; i++) {
+    res = crc32c_extend(res, crcs[i], get_part(i).size());
+  }
+  return res;
+}
+
 #endif
 
 static const uint64 crc64_table[256] = {
@@ -31,6 +31,7 @@ class AesCtrState {
 
   void init(const UInt256 &key, const UInt128 &iv);
 
+  // from and to may point to the same memory to encrypt in place
   void encrypt(Slice from, MutableSlice to);
 
   void decrypt(Slice from, MutableSlice to);
@@ -108,6 +109,10 @@ uint32 crc32(Slice data);
 uint32 crc32c(Slice data);
 uint32 crc32c_extend(uint32 old_crc, Slice data);
 uint32 crc32c_extend(uint32 old_crc, uint32 new_crc, size_t data_size);
+
+// Same as crc32c(data). Large data is split into up to threads_n parts, which are checksummed in parallel
+// and combined with crc32c_extend
+uint32 crc32c_parallel(Slice data, int threads_n);
 #endif
 
 uint64 crc64(Slice data);
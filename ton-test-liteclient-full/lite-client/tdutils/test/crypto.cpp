@@ -2,9 +2,12 @@
 #include "td/utils/benchmark.h"
 #include "td/utils/common.h"
 #include "td/utils/crypto.h"
+#include "td/utils/Random.h"
+#include "td/utils/Sha256Batch.h"
 #include "td/utils/Slice.h"
 #include "td/utils/tests.h"
 
+#include <algorithm>
 #include <limits>
 
 static td::vector<td::string> strings{"", "1", "short test string", td::string(1000000, 'a')};
@@ -130,6 +133,39 @@ TEST(Crypto, sha256) {
   }
 }
 
+TEST(Crypto, sha256_batch) {
+  // every kernel the CPU supports is checked, not only the one sha256_batch picks
+  auto implementations = td::sha256_batch_implementations();
+  ASSERT_TRUE(std::find(implementations.begin(), implementations.end(), td::sha256_batch_implementation()) !=
+              implementations.end());
+  for (auto implementation : implementations) {
+    for (int t = 0; t < 1000; t++) {
+      auto n = td::Random::fast(1, 70);
+      td::vector<td::string> messages(n);
+      td::vector<td::UInt256> hashes(n);
+      td::vector<td::Slice> inputs;
+      td::vector<td::MutableSlice> outputs;
+      for (int i = 0; i < n; i++) {
+        // lengths around the block boundaries are the interesting ones
+        messages[i] = td::rand_string(std::numeric_limits<char>::min(), std::numeric_limits<char>::max(),
+                                      td::Random::fast(0, t % 10 == 0 ? 1200 : 300));
+        inputs.push_back(messages[i]);
+        outputs.push_back(as_slice(hashes[i]));
+      }
+      if (t % 2 == 0) {
+        td::sha256_batch_with(implementation, inputs, outputs);
+      } else {
+        td::sha256_batch(inputs, outputs);
+      }
+      for (int i = 0; i < n; i++) {
+        td::UInt256 baseline;
+        td::sha256(messages[i], as_slice(baseline));
+        ASSERT_TRUE(baseline == hashes[i]);
+      }
+    }
+  }
+}
+
 TEST(Crypto, md5) {
   td::vector<td::Slice> answers{
       "1B2M2Y8AsgTpgAmY7PhCfg==", "xMpCOKC5I4INzFCab3WEmw==", "vwBninYbDRkgk+uA7GMiIQ==", "dwfWrk4CfHDuoqk1wilvIQ=="};
@@ -212,6 +248,49 @@ TEST(Crypto, crc32c_benchmark) {
   bench(Crc32cExtendBenchmark(128));
   bench(Crc32cExtendBenchmark(65536));
 }
+TEST(Crypto, crc32c_parallel) {
+  for (auto size : {0, 1, 1000, (1 << 22) - 1, 1 << 22, 3 << 22, (5 << 22) + 7}) {
+    std::string data(size, '\0');
+    for (auto &c : data) {
+      c = static_cast<char>(td::Random::fast(0, 255));
+    }
+    auto crc = td::crc32c(data);
+    for (int threads_n : {0, 1, 2, 3, 8}) {
+      ASSERT_EQ(crc, td::crc32c_parallel(data, threads_n));
+    }
+  }
+}
+TEST(Crypto, crc32c_parallel_benchmark) {
+  class Crc32cParallelBenchmark : public td::Benchmark {
+   public:
+    explicit Crc32cParallelBenchmark(int threads_n) : threads_n_(threads_n) {
+    }
+    std::string get_description() const override {
+      return PSTRING() << "Crc32c of " << (data_size >> 20) << "MB on " << threads_n_ << " threads";
+    }
+    void start_up() override {
+      data_ = std::string(data_size, 'a');
+    }
+    void tear_down() override {
+      data_ = std::string();
+    }
+    void run(int n) override {
+      td::uint32 res = 0;
+      for (int i = 0; i < n; i++) {
+        res ^= td::crc32c_parallel(data_, threads_n_);
+      }
+      td::do_not_optimize_away(res);
+    }
+
+   private:
+    size_t data_size{256 << 20};
+    int threads_n_;
+    std::string data_;
+  };
+  for (int threads_n : {1, 2, 4, 8}) {
+    bench(Crc32cParallelBenchmark(threads_n));
+  }
+}
 #endif
 
 TEST(Crypto, crc64) {